@@ -1,5 +1,7 @@
 ﻿#include "ResultErrorHandlingType.h"
 
+#include "ResultType/ErrorLog.h"
+
 #define LOCTEXT_NAMESPACE "FResultErrorHandlingTypeModule"
 
 void FResultErrorHandlingTypeModule::StartupModule()
@@ -9,7 +11,7 @@ void FResultErrorHandlingTypeModule::StartupModule()
 
 void FResultErrorHandlingTypeModule::ShutdownModule()
 {
-    
+    FErrorLogSink::StopShared();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,92 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ResultType/AnyError.h"
+
+FAnyError::FAnyError(const FAnyError& Other)
+{
+    if (Other.VTable)
+    {
+        Other.VTable->CopyConstruct(*this, Other);
+        VTable = Other.VTable;
+    }
+}
+
+FAnyError::FAnyError(FAnyError&& Other) noexcept
+{
+    if (Other.VTable)
+    {
+        Other.VTable->MoveConstruct(*this, Other);
+        VTable = Other.VTable;
+        Other.VTable = nullptr;
+    }
+}
+
+FAnyError::~FAnyError()
+{
+    Reset();
+}
+
+FAnyError& FAnyError::operator=(const FAnyError& Other)
+{
+    if (this != &Other)
+    {
+        Reset();
+        if (Other.VTable)
+        {
+            Other.VTable->CopyConstruct(*this, Other);
+            VTable = Other.VTable;
+        }
+    }
+    return *this;
+}
+
+FAnyError& FAnyError::operator=(FAnyError&& Other) noexcept
+{
+    if (this != &Other)
+    {
+        Reset();
+        if (Other.VTable)
+        {
+            Other.VTable->MoveConstruct(*this, Other);
+            VTable = Other.VTable;
+            Other.VTable = nullptr;
+        }
+    }
+    return *this;
+}
+
+void FAnyError::Reset()
+{
+    if (VTable)
+    {
+        VTable->Destroy(*this);
+        VTable = nullptr;
+    }
+}
+
+FString FAnyError::GetErrorMessage() const
+{
+    return VTable ? VTable->GetErrorMessage(GetObject()) : FString();
+}
+
+int32 FAnyError::GetErrorCode() const
+{
+    return VTable ? VTable->GetErrorCode(GetObject()) : 0;
+}
+
+const FAnyError* FAnyError::GetErrorSource() const
+{
+    return VTable ? VTable->GetErrorSource(GetObject()) : nullptr;
+}
+
+bool FAnyError::IsSameType(const FVTable* Other) const
+{
+    if (VTable == nullptr)
+    {
+        return false;
+    }
+
+    // Each module gets its own copy of the table, so fall back to comparing type names
+    return VTable == Other || FCStringAnsi::Strcmp(VTable->GetTypeName(), Other->GetTypeName()) == 0;
+}
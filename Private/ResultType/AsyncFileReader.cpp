@@ -0,0 +1,336 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ResultType/AsyncFileReader.h"
+
+#include "Async/Async.h"
+#include "Async/AsyncFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/ScopeLock.h"
+
+struct FAsyncFileReader::FReadOp
+{
+    int64 Offset = 0;
+    int64 Size = 0;
+    EIoPriority Priority = EIoPriority::Normal;
+    FIoBuffer Buffer;
+    TPromise<FIoReadResult> Promise;
+};
+
+namespace
+{
+    TFuture<FIoReadResult> MakeReadyFuture(FIoReadResult Result)
+    {
+        TPromise<FIoReadResult> Promise;
+        TFuture<FIoReadResult> Future = Promise.GetFuture();
+        Promise.SetValue(MoveTemp(Result));
+        return Future;
+    }
+
+    EAsyncIOPriorityAndFlags ToPlatformPriority(EIoPriority Priority)
+    {
+        switch (Priority)
+        {
+        case EIoPriority::Low:
+            return AIOP_Low;
+        case EIoPriority::High:
+            return AIOP_High;
+        case EIoPriority::Critical:
+            return AIOP_CriticalPath;
+        default:
+            return AIOP_Normal;
+        }
+    }
+}
+
+TResult<TSharedPtr<FAsyncFileReader, ESPMode::ThreadSafe>, FIoError> FAsyncFileReader::Open(const FString& Path, int32 MaxInFlight)
+{
+    using FOpenResult = TResult<TSharedPtr<FAsyncFileReader, ESPMode::ThreadSafe>, FIoError>;
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    if (!PlatformFile.FileExists(*Path))
+    {
+        return FOpenResult(ResultHelpers::Err, FIoError{EIoErrorKind::NotFound, Path, 0});
+    }
+
+    // Async handles usually open lazily and only fail on the first read, so probe access up front
+    TUniquePtr<IFileHandle> Probe(PlatformFile.OpenRead(*Path));
+    if (!Probe.IsValid())
+    {
+        return FOpenResult(ResultHelpers::Err, FIoError{EIoErrorKind::PermissionDenied, Path, 0});
+    }
+    const int64 FileSize = Probe->Size();
+    Probe.Reset();
+
+    IAsyncReadFileHandle* Handle = PlatformFile.OpenAsyncRead(*Path);
+    if (Handle == nullptr)
+    {
+        return FOpenResult(ResultHelpers::Err, FIoError{EIoErrorKind::PermissionDenied, Path, 0});
+    }
+
+    TSharedPtr<FAsyncFileReader, ESPMode::ThreadSafe> Reader(new FAsyncFileReader(Path, FileSize, Handle, FMath::Max(MaxInFlight, 1)));
+    return FOpenResult(ResultHelpers::Ok, Reader);
+}
+
+FAsyncFileReader::FAsyncFileReader(const FString& InPath, int64 InFileSize, IAsyncReadFileHandle* InHandle, int32 InMaxInFlight)
+    : Path(InPath)
+    , FileSize(InFileSize)
+    , MaxInFlight(InMaxInFlight)
+    , Handle(InHandle)
+{
+}
+
+FAsyncFileReader::~FAsyncFileReader()
+{
+    {
+        FScopeLock ScopeLock(&Lock);
+        bShuttingDown = true;
+    }
+    CancelPending();
+
+    while (true)
+    {
+        TArray<FIssuedRead> Outstanding;
+        {
+            FScopeLock ScopeLock(&Lock);
+            if (Issued.Num() == 0 && InFlight == 0)
+            {
+                break;
+            }
+            Outstanding = MoveTemp(Issued);
+            Issued.Reset();
+        }
+
+        // A read can be counted in flight before its request is registered, give the issuing thread time
+        if (Outstanding.Num() == 0)
+        {
+            FPlatformProcess::Sleep(0.0f);
+            continue;
+        }
+
+        for (const FIssuedRead& Read : Outstanding)
+        {
+            Read.Request->WaitCompletion();
+            delete Read.Request;
+        }
+    }
+
+    delete Handle;
+}
+
+TFuture<FIoReadResult> FAsyncFileReader::Read(const FIoReadRequest& Request)
+{
+    TFuture<FIoReadResult> Future;
+    FReadOpPtr Op = Prepare(Request, Future);
+    if (Op.IsValid())
+    {
+        TArray<FReadOpPtr> Ready;
+        {
+            FScopeLock ScopeLock(&Lock);
+            Pending[static_cast<int32>(Op->Priority)].Add(Op);
+            TakeDispatchable(Ready);
+        }
+        Dispatch(Ready);
+    }
+
+    RetireCompleted();
+    return Future;
+}
+
+TArray<TFuture<FIoReadResult>> FAsyncFileReader::ReadBatch(TArrayView<const FIoReadRequest> Requests)
+{
+    TArray<TFuture<FIoReadResult>> Futures;
+    Futures.Reserve(Requests.Num());
+
+    TArray<FReadOpPtr> Ops;
+    for (const FIoReadRequest& Request : Requests)
+    {
+        TFuture<FIoReadResult> Future;
+        FReadOpPtr Op = Prepare(Request, Future);
+        if (Op.IsValid())
+        {
+            Ops.Add(Op);
+        }
+        Futures.Add(MoveTemp(Future));
+    }
+
+    TArray<FReadOpPtr> Ready;
+    {
+        FScopeLock ScopeLock(&Lock);
+        for (const FReadOpPtr& Op : Ops)
+        {
+            Pending[static_cast<int32>(Op->Priority)].Add(Op);
+        }
+        TakeDispatchable(Ready);
+    }
+    Dispatch(Ready);
+
+    RetireCompleted();
+    return Futures;
+}
+
+void FAsyncFileReader::CancelPending()
+{
+    TArray<FReadOpPtr> Cancelled;
+    {
+        FScopeLock ScopeLock(&Lock);
+        for (TArray<FReadOpPtr>& Queue : Pending)
+        {
+            Cancelled.Append(MoveTemp(Queue));
+            Queue.Reset();
+        }
+    }
+
+    for (const FReadOpPtr& Op : Cancelled)
+    {
+        Op->Promise.SetValue(FIoReadResult(ResultHelpers::Err, FIoError{EIoErrorKind::Cancelled, Path, Op->Offset}));
+    }
+}
+
+int32 FAsyncFileReader::GetInFlightCount() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return InFlight;
+}
+
+int32 FAsyncFileReader::GetPendingCount() const
+{
+    FScopeLock ScopeLock(&Lock);
+    int32 Count = 0;
+    for (const TArray<FReadOpPtr>& Queue : Pending)
+    {
+        Count += Queue.Num();
+    }
+    return Count;
+}
+
+FAsyncFileReader::FReadOpPtr FAsyncFileReader::Prepare(const FIoReadRequest& Request, TFuture<FIoReadResult>& OutFuture) const
+{
+    if (Request.Offset < 0 || Request.Offset > FileSize)
+    {
+        OutFuture = MakeReadyFuture(FIoReadResult(ResultHelpers::Err, FIoError{EIoErrorKind::InvalidRange, Path, Request.Offset}));
+        return nullptr;
+    }
+
+    const int64 Size = Request.Size < 0 ? FileSize - Request.Offset : Request.Size;
+    if (Size > FileSize - Request.Offset)
+    {
+        OutFuture = MakeReadyFuture(FIoReadResult(ResultHelpers::Err, FIoError{EIoErrorKind::ShortRead, Path, Request.Offset}));
+        return nullptr;
+    }
+    if (Size == 0)
+    {
+        OutFuture = MakeReadyFuture(FIoReadResult(ResultHelpers::Ok, FIoBuffer()));
+        return nullptr;
+    }
+
+    FReadOpPtr Op = MakeShared<FReadOp, ESPMode::ThreadSafe>();
+    Op->Offset = Request.Offset;
+    Op->Size = Size;
+    Op->Priority = FMath::Clamp(Request.Priority, EIoPriority::Low, EIoPriority::Critical);
+    Op->Buffer = FIoBuffer(Size);
+    OutFuture = Op->Promise.GetFuture();
+    return Op;
+}
+
+void FAsyncFileReader::TakeDispatchable(TArray<FReadOpPtr>& OutOps)
+{
+    if (bShuttingDown)
+    {
+        return;
+    }
+
+    for (int32 PriorityIndex = static_cast<int32>(EIoPriority::Count) - 1; PriorityIndex >= 0 && InFlight < MaxInFlight; --PriorityIndex)
+    {
+        TArray<FReadOpPtr>& Queue = Pending[PriorityIndex];
+        int32 Taken = 0;
+        while (Taken < Queue.Num() && InFlight < MaxInFlight)
+        {
+            OutOps.Add(Queue[Taken++]);
+            ++InFlight;
+        }
+        Queue.RemoveAt(0, Taken);
+    }
+}
+
+void FAsyncFileReader::Dispatch(TArray<FReadOpPtr>& Ops)
+{
+    // Ops is a work list, a read that fails to issue frees its slot for the next queued read
+    for (int32 Index = 0; Index < Ops.Num(); ++Index)
+    {
+        const FReadOpPtr Op = Ops[Index];
+
+        // The callback may run before ReadRequest returns
+        FAsyncFileCallBack Callback = [this, Op](bool bWasCancelled, IAsyncReadRequest* Request)
+        {
+            OnReadComplete(Op, bWasCancelled, Request);
+        };
+
+        IAsyncReadRequest* Request = Handle->ReadRequest(Op->Offset, Op->Size, ToPlatformPriority(Op->Priority), &Callback, Op->Buffer.Data());
+        if (Request == nullptr)
+        {
+            {
+                FScopeLock ScopeLock(&Lock);
+                --InFlight;
+                TakeDispatchable(Ops);
+            }
+            Complete(Op, FIoReadResult(ResultHelpers::Err, FIoError{EIoErrorKind::ReadFailed, Path, Op->Offset}));
+            continue;
+        }
+
+        FScopeLock ScopeLock(&Lock);
+        Issued.Add(FIssuedRead{Request, Op});
+    }
+}
+
+void FAsyncFileReader::OnReadComplete(const FReadOpPtr& Op, bool bWasCancelled, IAsyncReadRequest* Request)
+{
+    FIoReadResult Result = bWasCancelled
+        ? FIoReadResult(ResultHelpers::Err, FIoError{EIoErrorKind::Cancelled, Path, Op->Offset})
+        : Request->GetReadResults() == nullptr
+            ? FIoReadResult(ResultHelpers::Err, FIoError{EIoErrorKind::ReadFailed, Path, Op->Offset})
+            : FIoReadResult(ResultHelpers::Ok, Op->Buffer);
+
+    // Keep the platform queue full before handing the data to continuations
+    TArray<FReadOpPtr> Ready;
+    {
+        FScopeLock ScopeLock(&Lock);
+        --InFlight;
+        TakeDispatchable(Ready);
+    }
+    Dispatch(Ready);
+
+    Complete(Op, MoveTemp(Result));
+}
+
+void FAsyncFileReader::Complete(const FReadOpPtr& Op, FIoReadResult&& Result)
+{
+    // Continuations may release the last reference to the reader, whose destructor waits on this request
+    Async(EAsyncExecution::TaskGraph, [Op, Result = MoveTemp(Result)]() mutable
+    {
+        Op->Promise.SetValue(MoveTemp(Result));
+    });
+}
+
+void FAsyncFileReader::RetireCompleted()
+{
+    TArray<IAsyncReadRequest*> Finished;
+    {
+        FScopeLock ScopeLock(&Lock);
+        for (int32 Index = Issued.Num() - 1; Index >= 0; --Index)
+        {
+            if (Issued[Index].Request->PollCompletion())
+            {
+                Finished.Add(Issued[Index].Request);
+                Issued.RemoveAtSwap(Index);
+            }
+        }
+    }
+
+    for (IAsyncReadRequest* Request : Finished)
+    {
+        Request->WaitCompletion();
+        delete Request;
+    }
+}
@@ -0,0 +1,112 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ResultType/BinaryCursor.h"
+
+namespace
+{
+    constexpr int32 MaxVarIntBytes = 10;
+}
+
+FString FDecodeError::GetErrorMessage() const
+{
+    switch (Kind)
+    {
+    case EDecodeErrorKind::OutOfBounds:
+        return FString::Printf(TEXT("Read past the end of the buffer at offset %d"), Offset);
+    case EDecodeErrorKind::InvalidVarInt:
+        return FString::Printf(TEXT("Malformed variable length integer at offset %d"), Offset);
+    case EDecodeErrorKind::InvalidLength:
+        return FString::Printf(TEXT("Invalid length at offset %d"), Offset);
+    default:
+        return FString::Printf(TEXT("Decode error at offset %d"), Offset);
+    }
+}
+
+TResult<TArrayView<const uint8>, FDecodeError> FBinaryCursor::ReadSpan(int32 Num)
+{
+    if (Num < 0)
+    {
+        return MakeError<TArrayView<const uint8>>(EDecodeErrorKind::InvalidLength);
+    }
+    if (!CanRead(Num))
+    {
+        return MakeError<TArrayView<const uint8>>(EDecodeErrorKind::OutOfBounds);
+    }
+
+    const TArrayView<const uint8> Span = Bytes.Slice(Position, Num);
+    Position += Num;
+    return TResult<TArrayView<const uint8>, FDecodeError>(ResultHelpers::Ok, Span);
+}
+
+TResult<TArrayView<const uint8>, FDecodeError> FBinaryCursor::ReadSizedSpan()
+{
+    const int32 Start = Position;
+    TResult<uint64, FDecodeError> Length = ReadVarInt();
+    if (Length.IsErr())
+    {
+        return TResult<TArrayView<const uint8>, FDecodeError>(ResultHelpers::Err, Length.UnwrapErr());
+    }
+
+    // Report failures at the length prefix and leave the cursor untouched
+    if (Length.Unwrap() > static_cast<uint64>(Remaining()))
+    {
+        const EDecodeErrorKind Kind = Length.Unwrap() > static_cast<uint64>(MAX_int32) ? EDecodeErrorKind::InvalidLength : EDecodeErrorKind::OutOfBounds;
+        Position = Start;
+        return MakeError<TArrayView<const uint8>>(Kind);
+    }
+    return ReadSpan(static_cast<int32>(Length.Unwrap()));
+}
+
+TVoidResult<FDecodeError> FBinaryCursor::Skip(int32 Num)
+{
+    if (Num < 0)
+    {
+        return MakeError<ResultHelpers::FUnit>(EDecodeErrorKind::InvalidLength);
+    }
+    if (!CanRead(Num))
+    {
+        return MakeError<ResultHelpers::FUnit>(EDecodeErrorKind::OutOfBounds);
+    }
+
+    Position += Num;
+    return TVoidResult<FDecodeError>(ResultHelpers::Ok, ResultHelpers::Unit);
+}
+
+TResult<uint64, FDecodeError> FBinaryCursor::ReadVarInt()
+{
+    const uint8* Data = Bytes.GetData() + Position;
+    const int32 Available = Remaining();
+
+    uint64 Value = 0;
+    for (int32 Index = 0; Index < MaxVarIntBytes; ++Index)
+    {
+        if (Index >= Available)
+        {
+            return MakeError<uint64>(EDecodeErrorKind::OutOfBounds);
+        }
+
+        const uint8 Byte = Data[Index];
+        // The tenth byte may only carry the top bit of a 64-bit value
+        if (Index == MaxVarIntBytes - 1 && Byte > 1)
+        {
+            return MakeError<uint64>(EDecodeErrorKind::InvalidVarInt);
+        }
+
+        Value |= static_cast<uint64>(Byte & 0x7F) << (7 * Index);
+        if ((Byte & 0x80) == 0)
+        {
+            Position += Index + 1;
+            return TResult<uint64, FDecodeError>(ResultHelpers::Ok, Value);
+        }
+    }
+    return MakeError<uint64>(EDecodeErrorKind::InvalidVarInt);
+}
+
+TResult<int64, FDecodeError> FBinaryCursor::ReadVarIntSigned()
+{
+    return ReadVarInt().Map([](uint64 Encoded)
+    {
+        return static_cast<int64>(Encoded >> 1) ^ -static_cast<int64>(Encoded & 1);
+    });
+}
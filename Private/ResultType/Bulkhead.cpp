@@ -0,0 +1,185 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ResultType/Bulkhead.h"
+
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+FBulkheadPermit::FBulkheadPermit(FBulkheadPermit&& Other)
+    : Bulkhead(Other.Bulkhead)
+{
+    Other.Bulkhead = nullptr;
+}
+
+FBulkheadPermit& FBulkheadPermit::operator=(FBulkheadPermit&& Other)
+{
+    if (this != &Other)
+    {
+        Reset();
+        Bulkhead = Other.Bulkhead;
+        Other.Bulkhead = nullptr;
+    }
+    return *this;
+}
+
+FBulkheadPermit::~FBulkheadPermit()
+{
+    Reset();
+}
+
+void FBulkheadPermit::Reset()
+{
+    if (Bulkhead != nullptr)
+    {
+        Bulkhead->Release();
+        Bulkhead = nullptr;
+    }
+}
+
+FResultBulkhead::FResultBulkhead(const FBulkheadOptions& InOptions)
+    : Options(InOptions)
+    , Available(FMath::Max(InOptions.MaxConcurrent, 1))
+{
+}
+
+FResultBulkhead::~FResultBulkhead()
+{
+    ensureMsgf(Available.load() == FMath::Max(Options.MaxConcurrent, 1) && Waiters.Num() == 0,
+        TEXT("FResultBulkhead destroyed with permits still held"));
+}
+
+TResult<FBulkheadPermit, FBulkheadError> FResultBulkhead::TryAcquire()
+{
+    // Leave free permits to queued callers so the queue stays first in, first out
+    if (NumWaiting.load(std::memory_order_relaxed) == 0 && TryTakePermit())
+    {
+        Admitted.fetch_add(1, std::memory_order_relaxed);
+        return TResult<FBulkheadPermit, FBulkheadError>(ResultHelpers::Ok, FBulkheadPermit(this));
+    }
+
+    Saturated.fetch_add(1, std::memory_order_relaxed);
+    return TResult<FBulkheadPermit, FBulkheadError>(ResultHelpers::Err, MakeError(EBulkheadErrorKind::Saturated));
+}
+
+TResult<FBulkheadPermit, FBulkheadError> FResultBulkhead::Acquire()
+{
+    if (Options.MaxWaiting <= 0 || Options.MaxWaitMs == 0)
+    {
+        return TryAcquire();
+    }
+
+    if (NumWaiting.load(std::memory_order_relaxed) == 0 && TryTakePermit())
+    {
+        Admitted.fetch_add(1, std::memory_order_relaxed);
+        return TResult<FBulkheadPermit, FBulkheadError>(ResultHelpers::Ok, FBulkheadPermit(this));
+    }
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    FWaiter Waiter;
+    {
+        FScopeLock ScopeLock(&WaitLock);
+        if (Waiters.Num() >= Options.MaxWaiting)
+        {
+            Saturated.fetch_add(1, std::memory_order_relaxed);
+            return TResult<FBulkheadPermit, FBulkheadError>(ResultHelpers::Err, MakeError(EBulkheadErrorKind::Saturated));
+        }
+
+        Waiter.Event = FPlatformProcess::GetSynchEventFromPool(false);
+        Waiters.Add(&Waiter);
+        NumWaiting.fetch_add(1);
+
+        // A permit released between the fast path and the enqueue would otherwise go unnoticed
+        GrantWaiters();
+    }
+
+    // The event is only triggered once the waiter holds a permit
+    bool bGranted = Waiter.Event->Wait(Options.MaxWaitMs);
+    if (!bGranted)
+    {
+        FScopeLock ScopeLock(&WaitLock);
+        bGranted = Waiter.bGranted;
+        if (!bGranted)
+        {
+            Waiters.Remove(&Waiter);
+            NumWaiting.fetch_sub(1);
+        }
+    }
+    FPlatformProcess::ReturnSynchEventToPool(Waiter.Event);
+
+    if (!bGranted)
+    {
+        TimedOut.fetch_add(1, std::memory_order_relaxed);
+        return TResult<FBulkheadPermit, FBulkheadError>(ResultHelpers::Err, MakeError(EBulkheadErrorKind::TimedOut));
+    }
+
+    const uint64 WaitCycles = FPlatformTime::Cycles64() - StartCycles;
+    Admitted.fetch_add(1, std::memory_order_relaxed);
+    AdmittedAfterWait.fetch_add(1, std::memory_order_relaxed);
+    TotalWaitCycles.fetch_add(WaitCycles, std::memory_order_relaxed);
+    uint64 Longest = MaxWaitCycles.load(std::memory_order_relaxed);
+    while (WaitCycles > Longest && !MaxWaitCycles.compare_exchange_weak(Longest, WaitCycles, std::memory_order_relaxed))
+    {
+    }
+    return TResult<FBulkheadPermit, FBulkheadError>(ResultHelpers::Ok, FBulkheadPermit(this));
+}
+
+FBulkheadMetrics FResultBulkhead::GetMetrics() const
+{
+    const double SecondsPerCycle = FPlatformTime::GetSecondsPerCycle64();
+
+    FBulkheadMetrics Metrics;
+    Metrics.InFlight = FMath::Max(Options.MaxConcurrent, 1) - Available.load(std::memory_order_relaxed);
+    Metrics.Waiting = NumWaiting.load(std::memory_order_relaxed);
+    Metrics.Admitted = Admitted.load(std::memory_order_relaxed);
+    Metrics.AdmittedAfterWait = AdmittedAfterWait.load(std::memory_order_relaxed);
+    Metrics.Saturated = Saturated.load(std::memory_order_relaxed);
+    Metrics.TimedOut = TimedOut.load(std::memory_order_relaxed);
+    Metrics.TotalWaitSeconds = TotalWaitCycles.load(std::memory_order_relaxed) * SecondsPerCycle;
+    Metrics.MaxWaitSeconds = MaxWaitCycles.load(std::memory_order_relaxed) * SecondsPerCycle;
+    return Metrics;
+}
+
+bool FResultBulkhead::TryTakePermit()
+{
+    int32 Count = Available.load();
+    while (Count > 0)
+    {
+        if (Available.compare_exchange_weak(Count, Count - 1, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void FResultBulkhead::GrantWaiters()
+{
+    // Called with WaitLock held
+    while (Waiters.Num() > 0 && TryTakePermit())
+    {
+        FWaiter* Next = Waiters[0];
+        Waiters.RemoveAt(0);
+        NumWaiting.fetch_sub(1);
+        Next->bGranted = true;
+        Next->Event->Trigger();
+    }
+}
+
+void FResultBulkhead::Release()
+{
+    // Pairs with the enqueue in Acquire, either the waiter sees this permit or this sees the waiter
+    Available.fetch_add(1);
+    if (NumWaiting.load() > 0)
+    {
+        FScopeLock ScopeLock(&WaitLock);
+        GrantWaiters();
+    }
+}
+
+FBulkheadError FResultBulkhead::MakeError(EBulkheadErrorKind Kind) const
+{
+    return FBulkheadError{Kind, FMath::Max(Options.MaxConcurrent, 1), NumWaiting.load(std::memory_order_relaxed)};
+}
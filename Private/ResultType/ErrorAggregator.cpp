@@ -0,0 +1,180 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ResultType/ErrorAggregator.h"
+
+#include "Misc/ScopeLock.h"
+
+#include <atomic>
+
+struct alignas(PLATFORM_CACHE_LINE_SIZE) FErrorAggregator::FThreadBuffer
+{
+    /** Only contended while EndFrame takes the entries */
+    FCriticalSection Lock;
+    TArray<FErrorFrameEntry> Entries;
+
+    /** Failing code paths tend to fail repeatedly, so the last matched entry is checked first */
+    int32 LastHit = 0;
+
+    /** Set when the aggregator is destroyed, so the thread drops the buffer from its cache */
+    std::atomic<bool> bRetired{false};
+};
+
+namespace
+{
+    std::atomic<uint64> NextAggregatorId{1};
+}
+
+FErrorAggregator& FErrorAggregator::Get()
+{
+    static FErrorAggregator Aggregator;
+    return Aggregator;
+}
+
+FErrorAggregator::FErrorAggregator()
+    : Id(NextAggregatorId.fetch_add(1))
+{
+}
+
+FErrorAggregator::~FErrorAggregator()
+{
+    FScopeLock ScopeLock(&RegistryLock);
+    for (const FThreadBufferPtr& Buffer : Buffers)
+    {
+        Buffer->bRetired.store(true);
+    }
+}
+
+FErrorFrameReport FErrorAggregator::EndFrame()
+{
+    TArray<FThreadBufferPtr> Snapshot;
+    FErrorFrameReport Report;
+    {
+        FScopeLock ScopeLock(&RegistryLock);
+        TArray<FThreadBufferPtr> Kept;
+        for (FThreadBufferPtr& Buffer : Buffers)
+        {
+            // Only the registry holds the buffer of an exited thread, its last entries are reported and it is let go
+            if (!Buffer.IsUnique())
+            {
+                Kept.Add(Buffer);
+            }
+            Snapshot.Add(MoveTemp(Buffer));
+        }
+        Buffers = MoveTemp(Kept);
+        Report.FrameIndex = FrameIndex++;
+    }
+
+    for (const FThreadBufferPtr& Buffer : Snapshot)
+    {
+        TArray<FErrorFrameEntry> ThreadEntries;
+        {
+            FScopeLock ScopeLock(&Buffer->Lock);
+            ThreadEntries = MoveTemp(Buffer->Entries);
+            Buffer->Entries.Reset();
+            Buffer->LastHit = 0;
+        }
+
+        for (FErrorFrameEntry& Entry : ThreadEntries)
+        {
+            Report.TotalCount += Entry.Count;
+
+            FErrorFrameEntry* Merged = nullptr;
+            for (FErrorFrameEntry& Existing : Report.Entries)
+            {
+                if (Existing.Site == Entry.Site && Existing.Code == Entry.Code)
+                {
+                    Merged = &Existing;
+                    break;
+                }
+            }
+
+            if (Merged)
+            {
+                Merged->Count += Entry.Count;
+                ++Merged->ThreadCount;
+            }
+            else
+            {
+                Report.Entries.Add(MoveTemp(Entry));
+            }
+        }
+    }
+
+    Report.Entries.Sort([](const FErrorFrameEntry& A, const FErrorFrameEntry& B) { return A.Count > B.Count; });
+    return Report;
+}
+
+uint64 FErrorAggregator::GetFrameIndex() const
+{
+    FScopeLock ScopeLock(&RegistryLock);
+    return FrameIndex;
+}
+
+int32 FErrorAggregator::GetThreadBufferCount() const
+{
+    FScopeLock ScopeLock(&RegistryLock);
+    return Buffers.Num();
+}
+
+void FErrorAggregator::RecordErased(const FErrorSite& Site, int32 Code, const void* Error, FAnyError (*MakeError)(const void*))
+{
+    FThreadBuffer& Buffer = GetThreadBuffer();
+    FScopeLock ScopeLock(&Buffer.Lock);
+
+    TArray<FErrorFrameEntry>& Entries = Buffer.Entries;
+    if (Entries.IsValidIndex(Buffer.LastHit) && Entries[Buffer.LastHit].Site == &Site && Entries[Buffer.LastHit].Code == Code)
+    {
+        ++Entries[Buffer.LastHit].Count;
+        return;
+    }
+
+    for (int32 Index = 0; Index < Entries.Num(); ++Index)
+    {
+        if (Entries[Index].Site == &Site && Entries[Index].Code == Code)
+        {
+            ++Entries[Index].Count;
+            Buffer.LastHit = Index;
+            return;
+        }
+    }
+
+    FErrorFrameEntry Entry;
+    Entry.Site = &Site;
+    Entry.Code = Code;
+    Entry.Count = 1;
+    Entry.ThreadCount = 1;
+    Entry.FirstError = MakeError(Error);
+    Buffer.LastHit = Entries.Add(MoveTemp(Entry));
+}
+
+FErrorAggregator::FThreadBuffer& FErrorAggregator::GetThreadBuffer()
+{
+    struct FCachedBuffer
+    {
+        uint64 AggregatorId;
+        FThreadBufferPtr Buffer;
+    };
+
+    // Destroying the cache at thread exit releases the thread's share of its buffers
+    static thread_local TArray<FCachedBuffer> Cache;
+    for (int32 Index = Cache.Num() - 1; Index >= 0; --Index)
+    {
+        if (Cache[Index].AggregatorId == Id)
+        {
+            return *Cache[Index].Buffer;
+        }
+        if (Cache[Index].Buffer->bRetired.load(std::memory_order_relaxed))
+        {
+            Cache.RemoveAtSwap(Index);
+        }
+    }
+
+    FThreadBufferPtr Buffer(new FThreadBuffer());
+    {
+        FScopeLock ScopeLock(&RegistryLock);
+        Buffers.Add(Buffer);
+    }
+    Cache.Add(FCachedBuffer{Id, Buffer});
+    return *Buffer;
+}
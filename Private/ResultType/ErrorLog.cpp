@@ -0,0 +1,185 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ResultType/ErrorLog.h"
+
+#include "Async/Async.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/Optional.h"
+
+namespace
+{
+    std::atomic<FErrorLogSink*> SharedSink{nullptr};
+}
+
+FString FErrorLogEntry::ToString() const
+{
+    FString Line = FString::Printf(TEXT("%s(%d): %s"), Site ? ANSI_TO_TCHAR(Site->GetFile()) : TEXT(""), Site ? Site->GetLine() : 0, *Message);
+    if (Code != 0)
+    {
+        Line += FString::Printf(TEXT(" [%d]"), Code);
+    }
+    if (Repeats > 1)
+    {
+        Line += FString::Printf(TEXT(" (x%d)"), Repeats);
+    }
+    if (Suppressed > 0)
+    {
+        Line += FString::Printf(TEXT(" (%d suppressed)"), Suppressed);
+    }
+    return Line;
+}
+
+FErrorLogSink& FErrorLogSink::Get()
+{
+    // Never destroyed, static destruction would join the worker and log after GLog is torn down
+    static FErrorLogSink* Sink = []()
+    {
+        FErrorLogSink* Created = new FErrorLogSink();
+        SharedSink.store(Created);
+        return Created;
+    }();
+    return *Sink;
+}
+
+void FErrorLogSink::StopShared()
+{
+    if (FErrorLogSink* Sink = SharedSink.load())
+    {
+        Sink->Stop();
+    }
+}
+
+FErrorLogSink::FErrorLogSink(FOutput&& InOutput, float InCoalesceSeconds)
+    : Output(MoveTemp(InOutput))
+    , CoalesceSeconds(FMath::Max(InCoalesceSeconds, 0.0f))
+    , WorkAvailable(FPlatformProcess::GetSynchEventFromPool(false))
+{
+    if (!Output)
+    {
+        Output = [](const FErrorLogEntry& Entry)
+        {
+            UE_LOG(LogTemp, Error, TEXT("%s"), *Entry.ToString());
+        };
+    }
+
+    Worker = Async(EAsyncExecution::Thread, [this]()
+    {
+        Run();
+    });
+}
+
+FErrorLogSink::~FErrorLogSink()
+{
+    Stop();
+    FPlatformProcess::ReturnSynchEventToPool(WorkAvailable);
+}
+
+void FErrorLogSink::Stop()
+{
+    bStopping.store(true);
+    WorkAvailable->Trigger();
+    Worker.Wait();
+}
+
+void FErrorLogSink::Flush()
+{
+    const uint64 Target = SubmittedCount.load();
+    ++FlushWaiters;
+
+    // A record racing with Stop may never be written, so stop waiting once the worker is gone
+    while (WrittenCount.load() < Target && !Worker.IsReady())
+    {
+        WorkAvailable->Trigger();
+        FPlatformProcess::Sleep(0.0001f);
+    }
+    --FlushWaiters;
+}
+
+void FErrorLogSink::Enqueue(FErrorLogSite& Site, FAnyError&& Error)
+{
+    if (bStopping.load())
+    {
+        return;
+    }
+
+    SubmittedCount.fetch_add(1);
+    Queue.Enqueue(FRecord{&Site, MoveTemp(Error), Site.TakeSuppressedCount()});
+
+    // Waking the worker is a system call, only pay for it when the worker is asleep
+    if (bWorkerIdle.exchange(false))
+    {
+        WorkAvailable->Trigger();
+    }
+}
+
+void FErrorLogSink::Run()
+{
+    TOptional<FErrorLogEntry> Pending;
+    uint64 PendingRecords = 0;
+    double PendingSince = 0.0;
+
+    auto WritePending = [&]()
+    {
+        Output(Pending.GetValue());
+        Pending.Reset();
+        WrittenCount.fetch_add(PendingRecords);
+        PendingRecords = 0;
+    };
+
+    while (true)
+    {
+        FRecord Record;
+        while (Queue.Dequeue(Record))
+        {
+            FErrorLogEntry Entry;
+            Entry.Site = Record.Site;
+            Entry.Message = Record.Error.GetErrorMessage();
+            Entry.Code = Record.Error.GetErrorCode();
+            Entry.Suppressed = Record.Suppressed;
+
+            if (Pending.IsSet() && Pending->Site == Entry.Site && Pending->Code == Entry.Code && Pending->Message == Entry.Message)
+            {
+                ++Pending->Repeats;
+                Pending->Suppressed += Entry.Suppressed;
+                ++PendingRecords;
+                continue;
+            }
+
+            if (Pending.IsSet())
+            {
+                WritePending();
+            }
+            Pending = MoveTemp(Entry);
+            PendingRecords = 1;
+            PendingSince = FPlatformTime::Seconds();
+        }
+
+        const bool bStop = bStopping.load();
+        const double PendingAge = FPlatformTime::Seconds() - PendingSince;
+        if (Pending.IsSet() && (bStop || FlushWaiters.load() > 0 || PendingAge >= CoalesceSeconds))
+        {
+            WritePending();
+        }
+
+        // Nothing is submitted once Stop has started, but records may have arrived after the drain
+        if (bStop)
+        {
+            if (Queue.IsEmpty())
+            {
+                break;
+            }
+            continue;
+        }
+
+        // Publish the idle flag before the last check so a concurrent submit either is seen here or wakes the event
+        bWorkerIdle.store(true);
+        if (Queue.IsEmpty())
+        {
+            const uint32 WaitMs = Pending.IsSet() ? static_cast<uint32>(FMath::Max((CoalesceSeconds - PendingAge) * 1000.0, 1.0)) : MAX_uint32;
+            WorkAvailable->Wait(WaitMs);
+        }
+        bWorkerIdle.store(false);
+    }
+}
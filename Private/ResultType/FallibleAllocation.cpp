@@ -0,0 +1,79 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ResultType/FallibleAllocation.h"
+
+#include "HAL/MemoryBase.h"
+
+#include <atomic>
+
+namespace
+{
+    std::atomic<void*> EmergencyReserve{nullptr};
+
+    void OnAllocationFailed(SIZE_T Count)
+    {
+        // Give the error path some room before it starts logging and unwinding
+        const bool bReleased = FFallibleMemory::ReleaseEmergencyReserve();
+        UE_LOG(LogTemp, Warning, TEXT("FFallibleMemory: failed to allocate %llu bytes%s"),
+            static_cast<uint64>(Count), bReleased ? TEXT(", emergency reserve released") : TEXT(""));
+    }
+}
+
+TResult<void*, EAllocError> FFallibleMemory::TryMalloc(SIZE_T Count, uint32 Alignment)
+{
+    // GMalloc is only null before the first allocation, when the plain path cannot fail either
+    void* Ptr = GMalloc ? GMalloc->TryMalloc(Count, Alignment) : FMemory::Malloc(Count, Alignment);
+    if (Ptr == nullptr && Count > 0)
+    {
+        OnAllocationFailed(Count);
+        return TResult<void*, EAllocError>(ResultHelpers::Err, EAllocError::OutOfMemory);
+    }
+    return TResult<void*, EAllocError>(ResultHelpers::Ok, Ptr);
+}
+
+TResult<void*, EAllocError> FFallibleMemory::TryRealloc(void* Original, SIZE_T Count, uint32 Alignment)
+{
+    void* Ptr = GMalloc ? GMalloc->TryRealloc(Original, Count, Alignment) : FMemory::Realloc(Original, Count, Alignment);
+    if (Ptr == nullptr && Count > 0)
+    {
+        OnAllocationFailed(Count);
+        return TResult<void*, EAllocError>(ResultHelpers::Err, EAllocError::OutOfMemory);
+    }
+    return TResult<void*, EAllocError>(ResultHelpers::Ok, Ptr);
+}
+
+TVoidResult<EAllocError> FFallibleMemory::TryProbe(SIZE_T Count, uint32 Alignment)
+{
+    TResult<void*, EAllocError> Probe = TryMalloc(Count, Alignment);
+    if (Probe.IsErr())
+    {
+        return TVoidResult<EAllocError>(ResultHelpers::Err, Probe.UnwrapErr());
+    }
+    FMemory::Free(Probe.Unwrap());
+    return TVoidResult<EAllocError>(ResultHelpers::Ok, ResultHelpers::Unit);
+}
+
+void FFallibleMemory::InitEmergencyReserve(SIZE_T Size)
+{
+    void* NewReserve = Size > 0 ? FMemory::Malloc(Size) : nullptr;
+    if (void* OldReserve = EmergencyReserve.exchange(NewReserve))
+    {
+        FMemory::Free(OldReserve);
+    }
+}
+
+bool FFallibleMemory::ReleaseEmergencyReserve()
+{
+    if (void* Reserve = EmergencyReserve.exchange(nullptr))
+    {
+        FMemory::Free(Reserve);
+        return true;
+    }
+    return false;
+}
+
+bool FFallibleMemory::HasEmergencyReserve()
+{
+    return EmergencyReserve.load() != nullptr;
+}
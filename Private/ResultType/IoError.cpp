@@ -0,0 +1,31 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ResultType/IoError.h"
+
+FString FIoError::GetErrorMessage() const
+{
+    switch (Kind)
+    {
+    case EIoErrorKind::NotFound:
+        return FString::Printf(TEXT("File not found: %s"), *Path);
+    case EIoErrorKind::PermissionDenied:
+        return FString::Printf(TEXT("Cannot open file: %s"), *Path);
+    case EIoErrorKind::InvalidRange:
+        return FString::Printf(TEXT("Invalid range at offset %lld in %s"), Offset, *Path);
+    case EIoErrorKind::MappingFailed:
+        return FString::Printf(TEXT("Failed to map %s at offset %lld"), *Path, Offset);
+    case EIoErrorKind::ShortRead:
+        return FString::Printf(TEXT("Read past the end of %s at offset %lld"), *Path, Offset);
+    case EIoErrorKind::ReadFailed:
+        return FString::Printf(TEXT("Failed to read %s at offset %lld"), *Path, Offset);
+    case EIoErrorKind::Cancelled:
+        return FString::Printf(TEXT("Read of %s at offset %lld was cancelled"), *Path, Offset);
+    case EIoErrorKind::WriteFailed:
+        return FString::Printf(TEXT("Failed to write %s at offset %lld"), *Path, Offset);
+    case EIoErrorKind::InvalidFormat:
+        return FString::Printf(TEXT("Unexpected data in %s at offset %lld"), *Path, Offset);
+    default:
+        return FString::Printf(TEXT("I/O error in %s"), *Path);
+    }
+}
@@ -0,0 +1,629 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ResultType/JsonPullReader.h"
+
+#include "ResultType/TextEncoding.h"
+
+namespace
+{
+    FORCEINLINE bool IsJsonWhitespace(uint8 Byte)
+    {
+        return Byte == ' ' || Byte == '\t' || Byte == '\n' || Byte == '\r';
+    }
+
+    FORCEINLINE bool IsDigitByte(uint8 Byte)
+    {
+        return static_cast<uint8>(Byte - '0') <= 9;
+    }
+
+    FORCEINLINE int32 HexValue(uint8 Byte)
+    {
+        if (IsDigitByte(Byte))
+        {
+            return Byte - '0';
+        }
+        const uint8 Lower = Byte | 0x20;
+        return (Lower >= 'a' && Lower <= 'f') ? Lower - 'a' + 10 : -1;
+    }
+
+    uint32 ReadHex4(const uint8* Data)
+    {
+        return (HexValue(Data[0]) << 12) | (HexValue(Data[1]) << 8) | (HexValue(Data[2]) << 4) | HexValue(Data[3]);
+    }
+
+    template<typename AllocatorType>
+    void AppendUtf8(TArray<uint8, AllocatorType>& Out, uint32 CodePoint)
+    {
+        if (CodePoint < 0x80)
+        {
+            Out.Add(static_cast<uint8>(CodePoint));
+        }
+        else if (CodePoint < 0x800)
+        {
+            Out.Add(static_cast<uint8>(0xC0 | (CodePoint >> 6)));
+            Out.Add(static_cast<uint8>(0x80 | (CodePoint & 0x3F)));
+        }
+        else if (CodePoint < 0x10000)
+        {
+            Out.Add(static_cast<uint8>(0xE0 | (CodePoint >> 12)));
+            Out.Add(static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F)));
+            Out.Add(static_cast<uint8>(0x80 | (CodePoint & 0x3F)));
+        }
+        else
+        {
+            Out.Add(static_cast<uint8>(0xF0 | (CodePoint >> 18)));
+            Out.Add(static_cast<uint8>(0x80 | ((CodePoint >> 12) & 0x3F)));
+            Out.Add(static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F)));
+            Out.Add(static_cast<uint8>(0x80 | (CodePoint & 0x3F)));
+        }
+    }
+}
+
+FString FJsonError::GetErrorMessage() const
+{
+    const TCHAR* Description = TEXT("Invalid JSON");
+    switch (Kind)
+    {
+    case EJsonErrorKind::UnexpectedCharacter:
+        Description = TEXT("Unexpected character");
+        break;
+    case EJsonErrorKind::UnexpectedEnd:
+        Description = TEXT("Unexpected end of document");
+        break;
+    case EJsonErrorKind::InvalidString:
+        Description = TEXT("Invalid string");
+        break;
+    case EJsonErrorKind::InvalidEscape:
+        Description = TEXT("Invalid escape sequence");
+        break;
+    case EJsonErrorKind::InvalidNumber:
+        Description = TEXT("Invalid number");
+        break;
+    case EJsonErrorKind::NestingTooDeep:
+        Description = TEXT("Nesting too deep");
+        break;
+    case EJsonErrorKind::TypeMismatch:
+        Description = TEXT("Unexpected value type");
+        break;
+    case EJsonErrorKind::OutOfRange:
+        Description = TEXT("Number out of range");
+        break;
+    }
+    return FString::Printf(TEXT("%s at line %d, column %d"), Description, Line, Column);
+}
+
+FJsonPullReader::FJsonPullReader(TArrayView<const uint8> InBytes)
+    : Bytes(InBytes)
+{
+}
+
+TResult<FJsonToken, FJsonError> FJsonPullReader::Next()
+{
+    ++TokenCount;
+    if (PeekedToken.IsSet())
+    {
+        TResult<FJsonToken, FJsonError> Token = MoveTemp(PeekedToken.GetValue());
+        PeekedToken.Reset();
+        return Token;
+    }
+    return ReadToken();
+}
+
+TResult<FJsonToken, FJsonError> FJsonPullReader::Peek()
+{
+    if (!PeekedToken.IsSet())
+    {
+        PeekedToken.Emplace(ReadToken());
+    }
+    return PeekedToken.GetValue();
+}
+
+TVoidResult<FJsonError> FJsonPullReader::SkipValue()
+{
+    int32 Depth = 0;
+    bool bValuePending = false;
+    do
+    {
+        TResult<FJsonToken, FJsonError> Token = Next();
+        if (Token.IsErr())
+        {
+            return TVoidResult<FJsonError>(ResultHelpers::Err, Token.UnwrapErr());
+        }
+
+        // A key is skipped together with the value of its member
+        bValuePending = Token.Unwrap().Type == EJsonTokenType::Key;
+
+        switch (Token.Unwrap().Type)
+        {
+        case EJsonTokenType::ObjectStart:
+        case EJsonTokenType::ArrayStart:
+            ++Depth;
+            break;
+        case EJsonTokenType::ObjectEnd:
+        case EJsonTokenType::ArrayEnd:
+        case EJsonTokenType::EndOfInput:
+            if (Depth == 0)
+            {
+                return Fail<ResultHelpers::FUnit>(EJsonErrorKind::TypeMismatch, Token.Unwrap().Offset);
+            }
+            --Depth;
+            break;
+        default:
+            break;
+        }
+    }
+    while (Depth > 0 || bValuePending);
+
+    return TVoidResult<FJsonError>(ResultHelpers::Ok, ResultHelpers::Unit);
+}
+
+FJsonError FJsonPullReader::MakeError(EJsonErrorKind Kind, int32 ErrorOffset) const
+{
+    FJsonError Error{Kind, ErrorOffset, 1, 1};
+
+    int32 LineStart = 0;
+    const int32 End = FMath::Min(ErrorOffset, Bytes.Num());
+    for (int32 Index = 0; Index < End; ++Index)
+    {
+        if (Bytes[Index] == '\n')
+        {
+            ++Error.Line;
+            LineStart = Index + 1;
+        }
+    }
+    Error.Column = ErrorOffset - LineStart + 1;
+    return Error;
+}
+
+TResult<bool, FJsonError> FJsonPullReader::ReadBool()
+{
+    TResult<FJsonToken, FJsonError> Token = Next();
+    if (Token.IsErr())
+    {
+        return TResult<bool, FJsonError>(ResultHelpers::Err, Token.UnwrapErr());
+    }
+
+    const EJsonTokenType Type = Token.Unwrap().Type;
+    if (Type != EJsonTokenType::True && Type != EJsonTokenType::False)
+    {
+        return Fail<bool>(EJsonErrorKind::TypeMismatch, Token.Unwrap().Offset);
+    }
+    return TResult<bool, FJsonError>(ResultHelpers::Ok, Type == EJsonTokenType::True);
+}
+
+TResult<FString, FJsonError> FJsonPullReader::ReadString()
+{
+    TResult<FJsonToken, FJsonError> Token = Next();
+    if (Token.IsErr())
+    {
+        return TResult<FString, FJsonError>(ResultHelpers::Err, Token.UnwrapErr());
+    }
+    if (Token.Unwrap().Type != EJsonTokenType::String)
+    {
+        return Fail<FString>(EJsonErrorKind::TypeMismatch, Token.Unwrap().Offset);
+    }
+    return DecodeString(Token.Unwrap());
+}
+
+TResult<FString, FJsonError> FJsonPullReader::DecodeString(const FJsonToken& Token) const
+{
+    const uint8* Raw = reinterpret_cast<const uint8*>(Token.Text.GetData());
+    const int32 Num = Token.Text.Len();
+    const int32 ContentOffset = Token.Offset + 1;
+
+    auto Convert = [this, ContentOffset](TArrayView<const uint8> Utf8)
+    {
+        TResult<FString, FEncodingError> Converted = Utf8ToTChar(Utf8);
+        if (Converted.IsErr())
+        {
+            return TResult<FString, FJsonError>(ResultHelpers::Err, MakeError(EJsonErrorKind::InvalidString, ContentOffset + Converted.UnwrapErr().Offset));
+        }
+        return TResult<FString, FJsonError>(ResultHelpers::Ok, Converted.Unwrap());
+    };
+
+    if (!Token.bHasEscapes)
+    {
+        return Convert(TArrayView<const uint8>(Raw, Num));
+    }
+
+    // The scanner already checked escape syntax, only surrogate pairing is left to validate
+    TArray<uint8, TInlineAllocator<256>> Unescaped;
+    Unescaped.Reserve(Num);
+    for (int32 Index = 0; Index < Num;)
+    {
+        if (Raw[Index] != '\\')
+        {
+            Unescaped.Add(Raw[Index++]);
+            continue;
+        }
+
+        const int32 EscapeStart = Index;
+        const uint8 Escape = Raw[Index + 1];
+        Index += 2;
+        switch (Escape)
+        {
+        case 'b':
+            Unescaped.Add(0x08);
+            break;
+        case 'f':
+            Unescaped.Add(0x0C);
+            break;
+        case 'n':
+            Unescaped.Add('\n');
+            break;
+        case 'r':
+            Unescaped.Add('\r');
+            break;
+        case 't':
+            Unescaped.Add('\t');
+            break;
+        case 'u':
+        {
+            uint32 CodePoint = ReadHex4(Raw + Index);
+            Index += 4;
+            if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF)
+            {
+                const bool bHasLow = Index + 6 <= Num && Raw[Index] == '\\' && Raw[Index + 1] == 'u';
+                const uint32 Low = bHasLow ? ReadHex4(Raw + Index + 2) : 0;
+                if (Low < 0xDC00 || Low > 0xDFFF)
+                {
+                    return TResult<FString, FJsonError>(ResultHelpers::Err, MakeError(EJsonErrorKind::InvalidEscape, ContentOffset + EscapeStart));
+                }
+                CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Low - 0xDC00);
+                Index += 6;
+            }
+            else if (CodePoint >= 0xDC00 && CodePoint <= 0xDFFF)
+            {
+                return TResult<FString, FJsonError>(ResultHelpers::Err, MakeError(EJsonErrorKind::InvalidEscape, ContentOffset + EscapeStart));
+            }
+            AppendUtf8(Unescaped, CodePoint);
+            break;
+        }
+        default:
+            Unescaped.Add(Escape);
+            break;
+        }
+    }
+    return Convert(TArrayView<const uint8>(Unescaped.GetData(), Unescaped.Num()));
+}
+
+TResult<FJsonToken, FJsonError> FJsonPullReader::ReadToken()
+{
+    if (bFailed)
+    {
+        return TResult<FJsonToken, FJsonError>(ResultHelpers::Err, StickyError);
+    }
+
+    while (true)
+    {
+        SkipWhitespace();
+        const bool bAtEnd = Position >= Bytes.Num();
+
+        switch (State)
+        {
+        case EState::Done:
+            if (!bAtEnd)
+            {
+                return Fail<FJsonToken>(EJsonErrorKind::UnexpectedCharacter, Position);
+            }
+            return TResult<FJsonToken, FJsonError>(ResultHelpers::Ok, MakeToken(EJsonTokenType::EndOfInput, Position, Position));
+
+        case EState::AfterValue:
+        {
+            if (Stack.Num() == 0)
+            {
+                State = EState::Done;
+                continue;
+            }
+            if (bAtEnd)
+            {
+                return Fail<FJsonToken>(EJsonErrorKind::UnexpectedEnd, Position);
+            }
+
+            const bool bInObject = Stack.Last() == '{';
+            const uint8 Byte = Bytes[Position];
+            if (Byte == ',')
+            {
+                ++Position;
+                State = bInObject ? EState::Key : EState::Value;
+                continue;
+            }
+            if (Byte == (bInObject ? '}' : ']'))
+            {
+                return CloseContainer();
+            }
+            return Fail<FJsonToken>(EJsonErrorKind::UnexpectedCharacter, Position);
+        }
+
+        case EState::FirstKeyOrEnd:
+        case EState::Key:
+            if (State == EState::FirstKeyOrEnd && !bAtEnd && Bytes[Position] == '}')
+            {
+                return CloseContainer();
+            }
+            return ReadKey();
+
+        case EState::FirstValueOrEnd:
+        case EState::Value:
+            if (State == EState::FirstValueOrEnd && !bAtEnd && Bytes[Position] == ']')
+            {
+                return CloseContainer();
+            }
+            return ReadValue();
+        }
+    }
+}
+
+TResult<FJsonToken, FJsonError> FJsonPullReader::ReadKey()
+{
+    if (Position >= Bytes.Num())
+    {
+        return Fail<FJsonToken>(EJsonErrorKind::UnexpectedEnd, Position);
+    }
+    if (Bytes[Position] != '"')
+    {
+        return Fail<FJsonToken>(EJsonErrorKind::UnexpectedCharacter, Position);
+    }
+
+    TResult<FJsonToken, FJsonError> Key = ScanString();
+    if (Key.IsErr())
+    {
+        return Key;
+    }
+
+    SkipWhitespace();
+    if (Position >= Bytes.Num())
+    {
+        return Fail<FJsonToken>(EJsonErrorKind::UnexpectedEnd, Position);
+    }
+    if (Bytes[Position] != ':')
+    {
+        return Fail<FJsonToken>(EJsonErrorKind::UnexpectedCharacter, Position);
+    }
+    ++Position;
+    State = EState::Value;
+
+    FJsonToken Token = Key.Unwrap();
+    Token.Type = EJsonTokenType::Key;
+    return TResult<FJsonToken, FJsonError>(ResultHelpers::Ok, Token);
+}
+
+TResult<FJsonToken, FJsonError> FJsonPullReader::ReadValue()
+{
+    if (Position >= Bytes.Num())
+    {
+        return Fail<FJsonToken>(EJsonErrorKind::UnexpectedEnd, Position);
+    }
+
+    const uint8 Byte = Bytes[Position];
+    switch (Byte)
+    {
+    case '{':
+    case '[':
+    {
+        if (Stack.Num() >= MaxDepth)
+        {
+            return Fail<FJsonToken>(EJsonErrorKind::NestingTooDeep, Position);
+        }
+        Stack.Add(Byte);
+        State = Byte == '{' ? EState::FirstKeyOrEnd : EState::FirstValueOrEnd;
+        ++Position;
+        const FJsonToken Token = MakeToken(Byte == '{' ? EJsonTokenType::ObjectStart : EJsonTokenType::ArrayStart, Position - 1, Position);
+        return TResult<FJsonToken, FJsonError>(ResultHelpers::Ok, Token);
+    }
+    case '"':
+        State = EState::AfterValue;
+        return ScanString();
+    case 't':
+        return ScanLiteral("true", 4, EJsonTokenType::True);
+    case 'f':
+        return ScanLiteral("false", 5, EJsonTokenType::False);
+    case 'n':
+        return ScanLiteral("null", 4, EJsonTokenType::Null);
+    default:
+        if (Byte == '-' || IsDigitByte(Byte))
+        {
+            return ScanNumber();
+        }
+        return Fail<FJsonToken>(EJsonErrorKind::UnexpectedCharacter, Position);
+    }
+}
+
+TResult<FJsonToken, FJsonError> FJsonPullReader::ScanString()
+{
+    const uint8* Data = Bytes.GetData();
+    const int32 Num = Bytes.Num();
+    const int32 Start = Position;
+
+    bool bHasEscapes = false;
+    bool bNonAscii = false;
+    int32 Index = Start + 1;
+    while (true)
+    {
+        // Plain characters are the common case, take them in a tight loop
+        while (Index < Num && Data[Index] != '"' && Data[Index] != '\\' && Data[Index] >= 0x20)
+        {
+            bNonAscii |= Data[Index] >= 0x80;
+            ++Index;
+        }
+
+        if (Index >= Num)
+        {
+            return Fail<FJsonToken>(EJsonErrorKind::UnexpectedEnd, Index);
+        }
+        if (Data[Index] == '"')
+        {
+            break;
+        }
+        if (Data[Index] < 0x20)
+        {
+            return Fail<FJsonToken>(EJsonErrorKind::InvalidString, Index);
+        }
+
+        bHasEscapes = true;
+        if (Index + 1 >= Num)
+        {
+            return Fail<FJsonToken>(EJsonErrorKind::UnexpectedEnd, Index + 1);
+        }
+
+        switch (Data[Index + 1])
+        {
+        case '"':
+        case '\\':
+        case '/':
+        case 'b':
+        case 'f':
+        case 'n':
+        case 'r':
+        case 't':
+            Index += 2;
+            break;
+        case 'u':
+            for (int32 Digit = 0; Digit < 4; ++Digit)
+            {
+                if (Index + 2 + Digit >= Num)
+                {
+                    return Fail<FJsonToken>(EJsonErrorKind::UnexpectedEnd, Index + 2 + Digit);
+                }
+                if (HexValue(Data[Index + 2 + Digit]) < 0)
+                {
+                    return Fail<FJsonToken>(EJsonErrorKind::InvalidEscape, Index);
+                }
+            }
+            Index += 6;
+            break;
+        default:
+            return Fail<FJsonToken>(EJsonErrorKind::InvalidEscape, Index);
+        }
+    }
+
+    const int32 ContentStart = Start + 1;
+    if (bNonAscii)
+    {
+        TVoidResult<FEncodingError> Valid = ValidateUtf8(Bytes.Slice(ContentStart, Index - ContentStart));
+        if (Valid.IsErr())
+        {
+            return Fail<FJsonToken>(EJsonErrorKind::InvalidString, ContentStart + Valid.UnwrapErr().Offset);
+        }
+    }
+
+    Position = Index + 1;
+    FJsonToken Token = MakeToken(EJsonTokenType::String, ContentStart, Index);
+    Token.Offset = Start;
+    Token.bHasEscapes = bHasEscapes;
+    return TResult<FJsonToken, FJsonError>(ResultHelpers::Ok, Token);
+}
+
+TResult<FJsonToken, FJsonError> FJsonPullReader::ScanNumber()
+{
+    const uint8* Data = Bytes.GetData();
+    const int32 Num = Bytes.Num();
+    const int32 Start = Position;
+
+    auto ExpectDigit = [this, Num](int32 Index)
+    {
+        return Fail<FJsonToken>(Index >= Num ? EJsonErrorKind::UnexpectedEnd : EJsonErrorKind::InvalidNumber, Index);
+    };
+
+    int32 Index = Start;
+    if (Data[Index] == '-')
+    {
+        ++Index;
+    }
+
+    if (Index < Num && Data[Index] == '0')
+    {
+        ++Index;
+    }
+    else if (Index < Num && IsDigitByte(Data[Index]))
+    {
+        while (Index < Num && IsDigitByte(Data[Index]))
+        {
+            ++Index;
+        }
+    }
+    else
+    {
+        return ExpectDigit(Index);
+    }
+
+    if (Index < Num && Data[Index] == '.')
+    {
+        ++Index;
+        if (Index >= Num || !IsDigitByte(Data[Index]))
+        {
+            return ExpectDigit(Index);
+        }
+        while (Index < Num && IsDigitByte(Data[Index]))
+        {
+            ++Index;
+        }
+    }
+
+    if (Index < Num && (Data[Index] == 'e' || Data[Index] == 'E'))
+    {
+        ++Index;
+        if (Index < Num && (Data[Index] == '+' || Data[Index] == '-'))
+        {
+            ++Index;
+        }
+        if (Index >= Num || !IsDigitByte(Data[Index]))
+        {
+            return ExpectDigit(Index);
+        }
+        while (Index < Num && IsDigitByte(Data[Index]))
+        {
+            ++Index;
+        }
+    }
+
+    Position = Index;
+    State = EState::AfterValue;
+    return TResult<FJsonToken, FJsonError>(ResultHelpers::Ok, MakeToken(EJsonTokenType::Number, Start, Index));
+}
+
+TResult<FJsonToken, FJsonError> FJsonPullReader::ScanLiteral(const char* Literal, int32 Length, EJsonTokenType Type)
+{
+    for (int32 Index = 0; Index < Length; ++Index)
+    {
+        if (Position + Index >= Bytes.Num())
+        {
+            return Fail<FJsonToken>(EJsonErrorKind::UnexpectedEnd, Position + Index);
+        }
+        if (Bytes[Position + Index] != static_cast<uint8>(Literal[Index]))
+        {
+            return Fail<FJsonToken>(EJsonErrorKind::UnexpectedCharacter, Position + Index);
+        }
+    }
+
+    const int32 Start = Position;
+    Position += Length;
+    State = EState::AfterValue;
+    return TResult<FJsonToken, FJsonError>(ResultHelpers::Ok, MakeToken(Type, Start, Position));
+}
+
+TResult<FJsonToken, FJsonError> FJsonPullReader::CloseContainer()
+{
+    const bool bObject = Stack.Pop() == '{';
+    State = EState::AfterValue;
+    ++Position;
+    return TResult<FJsonToken, FJsonError>(ResultHelpers::Ok, MakeToken(bObject ? EJsonTokenType::ObjectEnd : EJsonTokenType::ArrayEnd, Position - 1, Position));
+}
+
+FJsonToken FJsonPullReader::MakeToken(EJsonTokenType Type, int32 Start, int32 End) const
+{
+    FJsonToken Token;
+    Token.Type = Type;
+    Token.Text = FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Bytes.GetData() + Start), End - Start);
+    Token.Offset = Start;
+    return Token;
+}
+
+void FJsonPullReader::SkipWhitespace()
+{
+    while (Position < Bytes.Num() && IsJsonWhitespace(Bytes[Position]))
+    {
+        ++Position;
+    }
+}
@@ -0,0 +1,146 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ResultType/MappedFile.h"
+
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+
+#if PLATFORM_UNIX || PLATFORM_MAC || PLATFORM_ANDROID || PLATFORM_IOS
+#include <sys/mman.h>
+#define RESULT_MAPPED_MADVISE 1
+#else
+#define RESULT_MAPPED_MADVISE 0
+#endif
+
+struct FMappedRegion::FState
+{
+    FString Path;
+    int64 FileOffset = 0;
+
+    // The region must be released before the handle it was mapped from
+    TUniquePtr<IMappedFileHandle> Handle;
+    TUniquePtr<IMappedFileRegion> Region;
+};
+
+namespace
+{
+    TResult<FMappedRegion, FIoError> MakeIoError(EIoErrorKind Kind, const FString& Path, int64 Offset)
+    {
+        return TResult<FMappedRegion, FIoError>(ResultHelpers::Err, FIoError{Kind, Path, Offset});
+    }
+
+#if RESULT_MAPPED_MADVISE
+    int ToAdvice(EMappedAccessHint Hint)
+    {
+        switch (Hint)
+        {
+        case EMappedAccessHint::Sequential:
+            return MADV_SEQUENTIAL;
+        case EMappedAccessHint::Random:
+            return MADV_RANDOM;
+        case EMappedAccessHint::WillNeed:
+            return MADV_WILLNEED;
+        case EMappedAccessHint::DontNeed:
+            return MADV_DONTNEED;
+        default:
+            return MADV_NORMAL;
+        }
+    }
+#endif
+}
+
+TArrayView<const uint8> FMappedRegion::GetView() const
+{
+    if (!State.IsValid() || !State->Region.IsValid())
+    {
+        return TArrayView<const uint8>();
+    }
+    return TArrayView<const uint8>(State->Region->GetMappedPtr(), static_cast<int32>(State->Region->GetMappedSize()));
+}
+
+int64 FMappedRegion::GetFileOffset() const
+{
+    return State.IsValid() ? State->FileOffset : 0;
+}
+
+const FString& FMappedRegion::GetPath() const
+{
+    static const FString EmptyPath;
+    return State.IsValid() ? State->Path : EmptyPath;
+}
+
+void FMappedRegion::Advise(EMappedAccessHint Hint, int64 Offset, int64 Size) const
+{
+    const TArrayView<const uint8> View = GetView();
+    if (Offset < 0 || Offset >= View.Num() || Size <= 0)
+    {
+        return;
+    }
+    Size = FMath::Min<int64>(Size, View.Num() - Offset);
+
+#if RESULT_MAPPED_MADVISE
+    // madvise needs a page aligned start, the mapping itself always starts on a page boundary
+    const UPTRINT PageSize = FPlatformMemory::GetConstants().PageSize;
+    const UPTRINT Begin = reinterpret_cast<UPTRINT>(View.GetData() + Offset) & ~(PageSize - 1);
+    const UPTRINT End = reinterpret_cast<UPTRINT>(View.GetData() + Offset + Size);
+    madvise(reinterpret_cast<void*>(Begin), End - Begin, ToAdvice(Hint));
+#else
+    if (Hint == EMappedAccessHint::WillNeed)
+    {
+        State->Region->PreloadHint(Offset, Size);
+    }
+#endif
+}
+
+TResult<FMappedRegion, FIoError> MapFile(const FString& Path, int64 Offset, int64 Size, EMappedAccessHint Hint)
+{
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    if (!PlatformFile.FileExists(*Path))
+    {
+        return MakeIoError(EIoErrorKind::NotFound, Path, 0);
+    }
+
+    TUniquePtr<IMappedFileHandle> Handle(PlatformFile.OpenMapped(*Path));
+    if (!Handle.IsValid())
+    {
+        // Tell an unreadable file apart from a platform that cannot map it
+        TUniquePtr<IFileHandle> ReadHandle(PlatformFile.OpenRead(*Path));
+        return MakeIoError(ReadHandle.IsValid() ? EIoErrorKind::MappingFailed : EIoErrorKind::PermissionDenied, Path, 0);
+    }
+
+    const int64 FileSize = Handle->GetFileSize();
+    if (Offset < 0 || Offset > FileSize || Size < 0)
+    {
+        return MakeIoError(EIoErrorKind::InvalidRange, Path, Offset);
+    }
+
+    const int64 MappedSize = FMath::Min(Size, FileSize - Offset);
+    if (MappedSize > MAX_int32)
+    {
+        return MakeIoError(EIoErrorKind::InvalidRange, Path, Offset);
+    }
+
+    TSharedRef<FMappedRegion::FState, ESPMode::ThreadSafe> State = MakeShared<FMappedRegion::FState, ESPMode::ThreadSafe>();
+    State->Path = Path;
+    State->FileOffset = Offset;
+
+    // Empty ranges cannot be mapped on every platform, they are valid regions with an empty view
+    if (MappedSize > 0)
+    {
+        State->Region.Reset(Handle->MapRegion(Offset, MappedSize));
+        if (!State->Region.IsValid())
+        {
+            return MakeIoError(EIoErrorKind::MappingFailed, Path, Offset);
+        }
+    }
+    State->Handle = MoveTemp(Handle);
+
+    FMappedRegion Region;
+    Region.State = State;
+    if (Hint != EMappedAccessHint::Normal)
+    {
+        Region.Advise(Hint);
+    }
+    return TResult<FMappedRegion, FIoError>(ResultHelpers::Ok, MoveTemp(Region));
+}
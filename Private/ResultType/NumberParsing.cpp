@@ -0,0 +1,217 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ResultType/NumberParsing.h"
+
+#include "ResultType/CheckedMath.h"
+
+namespace
+{
+    // Largest digit count that always fits in a uint64 without overflow checks
+    constexpr int32 SafeUInt64Digits = 19;
+
+    // Powers of ten that are exactly representable as doubles
+    constexpr double ExactPowersOfTen[] =
+    {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    constexpr uint64 MaxExactMantissa = 1ull << 53;
+    constexpr int32 MaxExponentDigitsValue = 100000;
+
+    FORCEINLINE bool IsDigit(TCHAR Char)
+    {
+        return static_cast<uint32>(Char - TEXT('0')) <= 9u;
+    }
+
+    FORCEINLINE TResult<double, FParseError> MakeError(EParseErrorKind Kind, int32 Offset)
+    {
+        return TResult<double, FParseError>(ResultHelpers::Err, FParseError{Kind, Offset});
+    }
+}
+
+FString FParseError::GetErrorMessage() const
+{
+    switch (Kind)
+    {
+    case EParseErrorKind::Empty:
+        return FString::Printf(TEXT("Empty input at offset %d"), Offset);
+    case EParseErrorKind::InvalidCharacter:
+        return FString::Printf(TEXT("Invalid character at offset %d"), Offset);
+    case EParseErrorKind::Overflow:
+        return FString::Printf(TEXT("Value out of range at offset %d"), Offset);
+    case EParseErrorKind::UnexpectedEnd:
+        return FString::Printf(TEXT("Unexpected end of input at offset %d"), Offset);
+    default:
+        return FString::Printf(TEXT("Parse error at offset %d"), Offset);
+    }
+}
+
+TResult<uint64, FParseError> ResultHelpers::ParseDigits(FStringView Text, int32 BaseOffset)
+{
+    const int32 Len = Text.Len();
+    if (Len == 0)
+    {
+        return TResult<uint64, FParseError>(Err, FParseError{EParseErrorKind::UnexpectedEnd, BaseOffset});
+    }
+
+    const TCHAR* Chars = Text.GetData();
+
+    // Branch-free validation pass the compiler can vectorize, the invalid position is only located on failure
+    bool bInvalid = false;
+    for (int32 Index = 0; Index < Len; ++Index)
+    {
+        bInvalid |= !IsDigit(Chars[Index]);
+    }
+
+    if (UNLIKELY(bInvalid))
+    {
+        int32 Index = 0;
+        while (IsDigit(Chars[Index]))
+        {
+            ++Index;
+        }
+        return TResult<uint64, FParseError>(Err, FParseError{EParseErrorKind::InvalidCharacter, BaseOffset + Index});
+    }
+
+    int32 Index = 0;
+    while (Index < Len - 1 && Chars[Index] == TEXT('0'))
+    {
+        ++Index;
+    }
+
+    uint64 Value = 0;
+    const int32 SafeEnd = FMath::Min(Len, Index + SafeUInt64Digits);
+    for (; Index < SafeEnd; ++Index)
+    {
+        Value = Value * 10 + static_cast<uint64>(Chars[Index] - TEXT('0'));
+    }
+
+    for (; Index < Len; ++Index)
+    {
+        if (MulOverflows<uint64>(Value, 10, Value) || AddOverflows<uint64>(Value, static_cast<uint64>(Chars[Index] - TEXT('0')), Value))
+        {
+            return TResult<uint64, FParseError>(Err, FParseError{EParseErrorKind::Overflow, BaseOffset});
+        }
+    }
+
+    return TResult<uint64, FParseError>(Ok, Value);
+}
+
+TResult<double, FParseError> ResultHelpers::ParseDouble(FStringView Text)
+{
+    const int32 Len = Text.Len();
+    if (Len == 0)
+    {
+        return MakeError(EParseErrorKind::Empty, 0);
+    }
+
+    int32 Index = 0;
+    bool bNegative = false;
+    if (Text[0] == TEXT('+') || Text[0] == TEXT('-'))
+    {
+        bNegative = Text[0] == TEXT('-');
+        ++Index;
+    }
+
+    uint64 Mantissa = 0;
+    int32 MantissaDigits = 0;
+    int32 Exponent = 0;
+    bool bExact = true;
+    bool bAnyDigit = false;
+
+    // Integer part
+    for (; Index < Len && IsDigit(Text[Index]); ++Index)
+    {
+        const uint32 Digit = Text[Index] - TEXT('0');
+        bAnyDigit = true;
+        if (MantissaDigits < SafeUInt64Digits)
+        {
+            Mantissa = Mantissa * 10 + Digit;
+            MantissaDigits += Mantissa != 0 ? 1 : 0;
+        }
+        else
+        {
+            ++Exponent;
+            bExact &= Digit == 0;
+        }
+    }
+
+    // Fraction
+    if (Index < Len && Text[Index] == TEXT('.'))
+    {
+        for (++Index; Index < Len && IsDigit(Text[Index]); ++Index)
+        {
+            const uint32 Digit = Text[Index] - TEXT('0');
+            bAnyDigit = true;
+            if (MantissaDigits < SafeUInt64Digits)
+            {
+                Mantissa = Mantissa * 10 + Digit;
+                MantissaDigits += Mantissa != 0 ? 1 : 0;
+                --Exponent;
+            }
+            else
+            {
+                bExact &= Digit == 0;
+            }
+        }
+    }
+
+    if (!bAnyDigit)
+    {
+        return MakeError(Index >= Len ? EParseErrorKind::UnexpectedEnd : EParseErrorKind::InvalidCharacter, Index);
+    }
+
+    // Exponent
+    if (Index < Len && (Text[Index] == TEXT('e') || Text[Index] == TEXT('E')))
+    {
+        ++Index;
+        bool bNegativeExponent = false;
+        if (Index < Len && (Text[Index] == TEXT('+') || Text[Index] == TEXT('-')))
+        {
+            bNegativeExponent = Text[Index] == TEXT('-');
+            ++Index;
+        }
+        if (Index >= Len || !IsDigit(Text[Index]))
+        {
+            return MakeError(Index >= Len ? EParseErrorKind::UnexpectedEnd : EParseErrorKind::InvalidCharacter, Index);
+        }
+
+        int32 ExponentValue = 0;
+        for (; Index < Len && IsDigit(Text[Index]); ++Index)
+        {
+            ExponentValue = FMath::Min(ExponentValue * 10 + static_cast<int32>(Text[Index] - TEXT('0')), MaxExponentDigitsValue);
+        }
+        Exponent += bNegativeExponent ? -ExponentValue : ExponentValue;
+    }
+
+    if (Index != Len)
+    {
+        return MakeError(EParseErrorKind::InvalidCharacter, Index);
+    }
+
+    // Exact fast path: both the mantissa and the power of ten are exact doubles, so one rounding gives the correct result
+    if (bExact && Mantissa <= MaxExactMantissa && Exponent >= -22 && Exponent <= 22)
+    {
+        double Value = static_cast<double>(Mantissa);
+        Value = Exponent < 0 ? Value / ExactPowersOfTen[-Exponent] : Value * ExactPowersOfTen[Exponent];
+        return TResult<double, FParseError>(Ok, bNegative ? -Value : Value);
+    }
+
+    // The grammar was validated above, so the text is plain ASCII
+    TArray<ANSICHAR, TInlineAllocator<64>> Buffer;
+    Buffer.SetNumUninitialized(Len + 1);
+    for (int32 CharIndex = 0; CharIndex < Len; ++CharIndex)
+    {
+        Buffer[CharIndex] = static_cast<ANSICHAR>(Text[CharIndex]);
+    }
+    Buffer[Len] = '\0';
+
+    const double Value = FCStringAnsi::Atod(Buffer.GetData());
+    if (!FMath::IsFinite(Value))
+    {
+        return MakeError(EParseErrorKind::Overflow, 0);
+    }
+    return TResult<double, FParseError>(Ok, Value);
+}
@@ -0,0 +1,249 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ResultType/OutcomeRecorder.h"
+
+#include "Async/Async.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "ResultType/BinaryCursor.h"
+
+namespace
+{
+    constexpr uint32 OutcomeStreamMagic = 0x54554F52;
+    constexpr uint32 OutcomeStreamVersion = 1;
+
+    /** Outcomes are written once this many bytes are batched, or when the queue runs dry */
+    constexpr int32 WriteBatchSize = 64 * 1024;
+
+    /** How long the writer sleeps between batches when nobody is flushing */
+    constexpr uint32 WriterIntervalMs = 5;
+
+    void AppendUint32(TArray<uint8>& Out, uint32 Value)
+    {
+        for (int32 Shift = 0; Shift < 32; Shift += 8)
+        {
+            Out.Add(static_cast<uint8>(Value >> Shift));
+        }
+    }
+
+    void AppendVarInt(TArray<uint8>& Out, uint64 Value)
+    {
+        while (Value >= 0x80)
+        {
+            Out.Add(static_cast<uint8>(Value) | 0x80);
+            Value >>= 7;
+        }
+        Out.Add(static_cast<uint8>(Value));
+    }
+}
+
+TResult<FOutcomeRecorder::FRecorderPtr, FIoError> FOutcomeRecorder::StartRecording(const FString& Path)
+{
+    using FStartResult = TResult<FRecorderPtr, FIoError>;
+
+    IFileHandle* Handle = FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*Path);
+    if (Handle == nullptr)
+    {
+        return FStartResult(ResultHelpers::Err, FIoError{EIoErrorKind::PermissionDenied, Path, 0});
+    }
+
+    FRecorderPtr Recorder(new FOutcomeRecorder(EOutcomeMode::Record, Path));
+    Recorder->Handle = Handle;
+
+    TArray<uint8> Header;
+    AppendUint32(Header, OutcomeStreamMagic);
+    AppendUint32(Header, OutcomeStreamVersion);
+    if (!Handle->Write(Header.GetData(), Header.Num()))
+    {
+        return FStartResult(ResultHelpers::Err, FIoError{EIoErrorKind::WriteFailed, Path, 0});
+    }
+
+    Recorder->WorkAvailable = FPlatformProcess::GetSynchEventFromPool(false);
+    Recorder->WriterTask = Async(EAsyncExecution::Thread, [Raw = Recorder.Get()]()
+    {
+        Raw->RunWriter();
+    });
+    return FStartResult(ResultHelpers::Ok, Recorder);
+}
+
+TResult<FOutcomeRecorder::FRecorderPtr, FIoError> FOutcomeRecorder::StartReplay(const FString& Path)
+{
+    using FStartResult = TResult<FRecorderPtr, FIoError>;
+
+    FRecorderPtr Recorder(new FOutcomeRecorder(EOutcomeMode::Replay, Path));
+    if (!FFileHelper::LoadFileToArray(Recorder->ReplayBytes, *Path))
+    {
+        const bool bExists = FPlatformFileManager::Get().GetPlatformFile().FileExists(*Path);
+        return FStartResult(ResultHelpers::Err, FIoError{bExists ? EIoErrorKind::ReadFailed : EIoErrorKind::NotFound, Path, 0});
+    }
+
+    TVoidResult<FIoError> Parsed = Recorder->ParseReplay();
+    if (Parsed.IsErr())
+    {
+        return FStartResult(ResultHelpers::Err, Parsed.UnwrapErr());
+    }
+    return FStartResult(ResultHelpers::Ok, Recorder);
+}
+
+FOutcomeRecorder::FOutcomeRecorder(EOutcomeMode InMode, const FString& InPath)
+    : Mode(InMode)
+    , Path(InPath)
+{
+}
+
+FOutcomeRecorder::~FOutcomeRecorder()
+{
+    if (WorkAvailable != nullptr)
+    {
+        bStopping.store(true);
+        WorkAvailable->Trigger();
+        WriterTask.Wait();
+        FPlatformProcess::ReturnSynchEventToPool(WorkAvailable);
+    }
+    delete Handle;
+}
+
+TVoidResult<FIoError> FOutcomeRecorder::Flush()
+{
+    if (Mode == EOutcomeMode::Record)
+    {
+        const uint64 Target = SubmittedCount.load();
+        while (WrittenCount.load() < Target)
+        {
+            WorkAvailable->Trigger();
+            FPlatformProcess::Sleep(0.0001f);
+        }
+    }
+
+    if (bWriteFailed.load())
+    {
+        return TVoidResult<FIoError>(ResultHelpers::Err, FIoError{EIoErrorKind::WriteFailed, Path, FailedOffset.load()});
+    }
+    return TVoidResult<FIoError>(ResultHelpers::Ok, ResultHelpers::Unit);
+}
+
+void FOutcomeRecorder::Submit(const FOutcomeChannel& Channel, bool bIsOk, TArray<uint8>&& Payload)
+{
+    // The writer polls, so recording never pays for waking it
+    SubmittedCount.fetch_add(1);
+    Pending.Enqueue(FPendingOutcome{Channel.Id, bIsOk, MoveTemp(Payload)});
+}
+
+void FOutcomeRecorder::RunWriter()
+{
+    TArray<uint8> Batch;
+    uint64 BatchOutcomes = 0;
+    int64 FileOffset = 8;
+
+    auto WriteBatch = [&]()
+    {
+        if (Batch.Num() > 0 && !bWriteFailed.load())
+        {
+            if (Handle->Write(Batch.GetData(), Batch.Num()))
+            {
+                FileOffset += Batch.Num();
+            }
+            else
+            {
+                FailedOffset.store(FileOffset);
+                bWriteFailed.store(true);
+            }
+        }
+        Batch.Reset();
+        WrittenCount.fetch_add(BatchOutcomes);
+        BatchOutcomes = 0;
+    };
+
+    while (true)
+    {
+        FPendingOutcome Outcome;
+        while (Pending.Dequeue(Outcome))
+        {
+            AppendUint32(Batch, Outcome.ChannelId);
+            Batch.Add(Outcome.bIsOk ? 1 : 0);
+            AppendVarInt(Batch, Outcome.Payload.Num());
+            Batch.Append(Outcome.Payload);
+            ++BatchOutcomes;
+
+            if (Batch.Num() >= WriteBatchSize)
+            {
+                WriteBatch();
+            }
+        }
+        WriteBatch();
+
+        // Nothing is recorded once the destructor has started, but outcomes may have arrived after the drain
+        if (bStopping.load())
+        {
+            if (Pending.IsEmpty())
+            {
+                break;
+            }
+            continue;
+        }
+        WorkAvailable->Wait(WriterIntervalMs);
+    }
+
+    Handle->Flush();
+}
+
+TOptional<FOutcomeRecorder::FReplayOutcome> FOutcomeRecorder::TakeReplayOutcome(const FOutcomeChannel& Channel)
+{
+    FScopeLock ScopeLock(&ReplayLock);
+    for (FReplayChannel& ReplayChannel : ReplayChannels)
+    {
+        if (ReplayChannel.Id == Channel.Id)
+        {
+            if (ReplayChannel.Next < ReplayChannel.Outcomes.Num())
+            {
+                return ReplayChannel.Outcomes[ReplayChannel.Next++];
+            }
+            break;
+        }
+    }
+    return TOptional<FReplayOutcome>();
+}
+
+TVoidResult<FIoError> FOutcomeRecorder::ParseReplay()
+{
+    FBinaryCursor Cursor(ReplayBytes);
+
+    TResult<TTuple<uint32, uint32>, FDecodeError> Header = Cursor.ReadBatch<uint32, uint32>();
+    if (Header.IsErr() || Header.Unwrap().Get<0>() != OutcomeStreamMagic || Header.Unwrap().Get<1>() != OutcomeStreamVersion)
+    {
+        return TVoidResult<FIoError>(ResultHelpers::Err, FIoError{EIoErrorKind::InvalidFormat, Path, 0});
+    }
+
+    while (!Cursor.IsAtEnd())
+    {
+        const int32 Start = Cursor.Tell();
+        TResult<TTuple<uint32, uint8>, FDecodeError> Tag = Cursor.ReadBatch<uint32, uint8>();
+        TResult<TArrayView<const uint8>, FDecodeError> Payload = Tag.IsOk()
+            ? Cursor.ReadSizedSpan()
+            : TResult<TArrayView<const uint8>, FDecodeError>(ResultHelpers::Err, Tag.UnwrapErr());
+        if (Payload.IsErr())
+        {
+            return TVoidResult<FIoError>(ResultHelpers::Err, FIoError{EIoErrorKind::InvalidFormat, Path, Start});
+        }
+
+        const uint32 ChannelId = Tag.Unwrap().Get<0>();
+        FReplayChannel* ReplayChannel = ReplayChannels.FindByPredicate([ChannelId](const FReplayChannel& Channel) { return Channel.Id == ChannelId; });
+        if (ReplayChannel == nullptr)
+        {
+            ReplayChannel = &ReplayChannels.AddDefaulted_GetRef();
+            ReplayChannel->Id = ChannelId;
+        }
+
+        FReplayOutcome Outcome;
+        Outcome.bIsOk = Tag.Unwrap().Get<1>() != 0;
+        Outcome.Offset = static_cast<int32>(Payload.Unwrap().GetData() - ReplayBytes.GetData());
+        Outcome.Size = Payload.Unwrap().Num();
+        ReplayChannel->Outcomes.Add(Outcome);
+    }
+
+    return TVoidResult<FIoError>(ResultHelpers::Ok, ResultHelpers::Unit);
+}
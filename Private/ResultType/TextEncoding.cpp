@@ -0,0 +1,369 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ResultType/TextEncoding.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+#include <emmintrin.h>
+#define RESULT_ENCODING_SSE2 1
+#define RESULT_ENCODING_NEON 0
+#elif PLATFORM_CPU_ARM_FAMILY && (defined(__aarch64__) || defined(_M_ARM64))
+#include <arm_neon.h>
+#define RESULT_ENCODING_SSE2 0
+#define RESULT_ENCODING_NEON 1
+#else
+#define RESULT_ENCODING_SSE2 0
+#define RESULT_ENCODING_NEON 0
+#endif
+
+namespace
+{
+    /** Returns the index of the first non-ASCII byte at or after Index */
+    int32 SkipAscii(const uint8* Data, int32 Num, int32 Index)
+    {
+#if RESULT_ENCODING_SSE2
+        for (; Index + 16 <= Num; Index += 16)
+        {
+            const __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + Index));
+            if (_mm_movemask_epi8(Chunk) != 0)
+            {
+                break;
+            }
+        }
+#elif RESULT_ENCODING_NEON
+        for (; Index + 16 <= Num; Index += 16)
+        {
+            if (vmaxvq_u8(vld1q_u8(Data + Index)) >= 0x80)
+            {
+                break;
+            }
+        }
+#endif
+        for (; Index + 8 <= Num; Index += 8)
+        {
+            uint64 Word;
+            FMemory::Memcpy(&Word, Data + Index, sizeof(Word));
+            if ((Word & 0x8080808080808080ull) != 0)
+            {
+                break;
+            }
+        }
+        while (Index < Num && Data[Index] < 0x80)
+        {
+            ++Index;
+        }
+        return Index;
+    }
+
+    FORCEINLINE bool IsSurrogate(UTF16CHAR Unit)
+    {
+        return (Unit & 0xF800) == 0xD800;
+    }
+
+    /** Returns the index of the first surrogate code unit at or after Index */
+    int32 SkipNonSurrogates(const UTF16CHAR* Data, int32 Num, int32 Index)
+    {
+#if RESULT_ENCODING_SSE2
+        const __m128i Mask = _mm_set1_epi16(static_cast<int16>(0xF800));
+        const __m128i Surrogate = _mm_set1_epi16(static_cast<int16>(0xD800));
+        for (; Index + 8 <= Num; Index += 8)
+        {
+            const __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + Index));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(Chunk, Mask), Surrogate)) != 0)
+            {
+                break;
+            }
+        }
+#elif RESULT_ENCODING_NEON
+        const uint16x8_t Mask = vdupq_n_u16(0xF800);
+        const uint16x8_t Surrogate = vdupq_n_u16(0xD800);
+        for (; Index + 8 <= Num; Index += 8)
+        {
+            const uint16x8_t Chunk = vld1q_u16(reinterpret_cast<const uint16*>(Data + Index));
+            if (vmaxvq_u16(vceqq_u16(vandq_u16(Chunk, Mask), Surrogate)) != 0)
+            {
+                break;
+            }
+        }
+#endif
+        while (Index < Num && !IsSurrogate(Data[Index]))
+        {
+            ++Index;
+        }
+        return Index;
+    }
+
+    FORCEINLINE bool IsContinuation(uint8 Byte)
+    {
+        return (Byte & 0xC0) == 0x80;
+    }
+
+    /**
+     * Decodes the multi-byte sequence starting at Index following the well-formed table of the Unicode standard
+     * On success advances Index past the sequence
+     */
+    TOptional<EEncodingErrorKind> DecodeUtf8Sequence(const uint8* Data, int32 Num, int32& Index, uint32& OutCodePoint)
+    {
+        const uint8 Lead = Data[Index];
+
+        int32 Length;
+        uint8 SecondMin = 0x80;
+        uint8 SecondMax = 0xBF;
+        EEncodingErrorKind SecondError = EEncodingErrorKind::InvalidContinuation;
+
+        if (Lead < 0x80)
+        {
+            OutCodePoint = Lead;
+            ++Index;
+            return TOptional<EEncodingErrorKind>();
+        }
+        else if (Lead < 0xC0)
+        {
+            return EEncodingErrorKind::UnexpectedContinuation;
+        }
+        else if (Lead < 0xC2)
+        {
+            return EEncodingErrorKind::Overlong;
+        }
+        else if (Lead < 0xE0)
+        {
+            Length = 2;
+            OutCodePoint = Lead & 0x1F;
+        }
+        else if (Lead < 0xF0)
+        {
+            Length = 3;
+            OutCodePoint = Lead & 0x0F;
+            if (Lead == 0xE0)
+            {
+                SecondMin = 0xA0;
+                SecondError = EEncodingErrorKind::Overlong;
+            }
+            else if (Lead == 0xED)
+            {
+                SecondMax = 0x9F;
+                SecondError = EEncodingErrorKind::Surrogate;
+            }
+        }
+        else if (Lead < 0xF5)
+        {
+            Length = 4;
+            OutCodePoint = Lead & 0x07;
+            if (Lead == 0xF0)
+            {
+                SecondMin = 0x90;
+                SecondError = EEncodingErrorKind::Overlong;
+            }
+            else if (Lead == 0xF4)
+            {
+                SecondMax = 0x8F;
+                SecondError = EEncodingErrorKind::OutOfRange;
+            }
+        }
+        else
+        {
+            return EEncodingErrorKind::InvalidLeadByte;
+        }
+
+        // Bytes present before the end of the buffer are checked first, so a bad byte is not reported as a truncation
+        const int32 Available = FMath::Min(Length, Num - Index);
+        if (Available > 1)
+        {
+            const uint8 Second = Data[Index + 1];
+            if (!IsContinuation(Second))
+            {
+                return EEncodingErrorKind::InvalidContinuation;
+            }
+            if (Second < SecondMin || Second > SecondMax)
+            {
+                return SecondError;
+            }
+            OutCodePoint = (OutCodePoint << 6) | (Second & 0x3F);
+        }
+
+        for (int32 Next = 2; Next < Available; ++Next)
+        {
+            const uint8 Byte = Data[Index + Next];
+            if (!IsContinuation(Byte))
+            {
+                return EEncodingErrorKind::InvalidContinuation;
+            }
+            OutCodePoint = (OutCodePoint << 6) | (Byte & 0x3F);
+        }
+
+        if (Available < Length)
+        {
+            return EEncodingErrorKind::Truncated;
+        }
+
+        Index += Length;
+        return TOptional<EEncodingErrorKind>();
+    }
+
+    template<typename CharArrayType>
+    FORCEINLINE void AppendCodePoint(CharArrayType& Chars, uint32 CodePoint)
+    {
+        if constexpr (sizeof(TCHAR) == 2)
+        {
+            if (CodePoint >= 0x10000)
+            {
+                CodePoint -= 0x10000;
+                Chars.Add(static_cast<TCHAR>(0xD800 + (CodePoint >> 10)));
+                Chars.Add(static_cast<TCHAR>(0xDC00 + (CodePoint & 0x3FF)));
+                return;
+            }
+        }
+        Chars.Add(static_cast<TCHAR>(CodePoint));
+    }
+
+    template<typename CharArrayType>
+    void TerminateCharArray(CharArrayType& Chars)
+    {
+        if (Chars.Num() > 0)
+        {
+            Chars.Add(TEXT('\0'));
+        }
+    }
+}
+
+FString FEncodingError::GetErrorMessage() const
+{
+    const TCHAR* Description;
+    switch (Kind)
+    {
+    case EEncodingErrorKind::InvalidLeadByte:        Description = TEXT("Invalid lead byte"); break;
+    case EEncodingErrorKind::UnexpectedContinuation: Description = TEXT("Unexpected continuation byte"); break;
+    case EEncodingErrorKind::InvalidContinuation:    Description = TEXT("Invalid continuation byte"); break;
+    case EEncodingErrorKind::Truncated:              Description = TEXT("Truncated sequence"); break;
+    case EEncodingErrorKind::Overlong:               Description = TEXT("Overlong encoding"); break;
+    case EEncodingErrorKind::Surrogate:              Description = TEXT("Encoded surrogate"); break;
+    case EEncodingErrorKind::OutOfRange:             Description = TEXT("Code point out of range"); break;
+    case EEncodingErrorKind::UnpairedSurrogate:      Description = TEXT("Unpaired surrogate"); break;
+    default:                                         Description = TEXT("Encoding error"); break;
+    }
+    return FString::Printf(TEXT("%s at offset %d"), Description, Offset);
+}
+
+TVoidResult<FEncodingError> ValidateUtf8(TArrayView<const uint8> Bytes)
+{
+    const uint8* Data = Bytes.GetData();
+    const int32 Num = Bytes.Num();
+
+    int32 Index = 0;
+    while (true)
+    {
+        Index = SkipAscii(Data, Num, Index);
+        if (Index >= Num)
+        {
+            return TVoidResult<FEncodingError>(ResultHelpers::Ok, ResultHelpers::Unit);
+        }
+
+        // Decode the non-ASCII run until the next ASCII byte
+        while (Index < Num && Data[Index] >= 0x80)
+        {
+            uint32 CodePoint;
+            const int32 SequenceStart = Index;
+            TOptional<EEncodingErrorKind> Error = DecodeUtf8Sequence(Data, Num, Index, CodePoint);
+            if (Error.IsSet())
+            {
+                return TVoidResult<FEncodingError>(ResultHelpers::Err, FEncodingError{Error.GetValue(), SequenceStart});
+            }
+        }
+    }
+}
+
+TVoidResult<FEncodingError> ValidateUtf16(TArrayView<const UTF16CHAR> Units)
+{
+    const UTF16CHAR* Data = Units.GetData();
+    const int32 Num = Units.Num();
+
+    int32 Index = 0;
+    while (true)
+    {
+        Index = SkipNonSurrogates(Data, Num, Index);
+        if (Index >= Num)
+        {
+            return TVoidResult<FEncodingError>(ResultHelpers::Ok, ResultHelpers::Unit);
+        }
+
+        const bool bHigh = Data[Index] < 0xDC00;
+        const bool bPaired = bHigh && Index + 1 < Num && Data[Index + 1] >= 0xDC00 && Data[Index + 1] <= 0xDFFF;
+        if (!bPaired)
+        {
+            return TVoidResult<FEncodingError>(ResultHelpers::Err, FEncodingError{EEncodingErrorKind::UnpairedSurrogate, Index});
+        }
+        Index += 2;
+    }
+}
+
+TResult<FString, FEncodingError> Utf8ToTChar(TArrayView<const uint8> Bytes)
+{
+    const uint8* Data = Bytes.GetData();
+    const int32 Num = Bytes.Num();
+
+    // Never more code units than bytes, for both UTF-16 and UTF-32 TCHAR
+    FString Result;
+    auto& Chars = Result.GetCharArray();
+    Chars.Reserve(Num + 1);
+
+    int32 Index = 0;
+    while (Index < Num)
+    {
+        const int32 AsciiEnd = SkipAscii(Data, Num, Index);
+        for (; Index < AsciiEnd; ++Index)
+        {
+            Chars.Add(static_cast<TCHAR>(Data[Index]));
+        }
+
+        while (Index < Num && Data[Index] >= 0x80)
+        {
+            uint32 CodePoint;
+            const int32 SequenceStart = Index;
+            TOptional<EEncodingErrorKind> Error = DecodeUtf8Sequence(Data, Num, Index, CodePoint);
+            if (Error.IsSet())
+            {
+                return TResult<FString, FEncodingError>(ResultHelpers::Err, FEncodingError{Error.GetValue(), SequenceStart});
+            }
+            AppendCodePoint(Chars, CodePoint);
+        }
+    }
+
+    TerminateCharArray(Chars);
+    return TResult<FString, FEncodingError>(ResultHelpers::Ok, MoveTemp(Result));
+}
+
+TResult<FString, FEncodingError> Utf16ToTChar(TArrayView<const UTF16CHAR> Units)
+{
+    TVoidResult<FEncodingError> Validation = ValidateUtf16(Units);
+    if (Validation.IsErr())
+    {
+        return TResult<FString, FEncodingError>(ResultHelpers::Err, Validation.UnwrapErr());
+    }
+
+    FString Result;
+    auto& Chars = Result.GetCharArray();
+    Chars.Reserve(Units.Num() + 1);
+
+    if constexpr (sizeof(TCHAR) == sizeof(UTF16CHAR))
+    {
+        Chars.AddUninitialized(Units.Num());
+        FMemory::Memcpy(Chars.GetData(), Units.GetData(), Units.Num() * sizeof(UTF16CHAR));
+    }
+    else
+    {
+        for (int32 Index = 0; Index < Units.Num(); ++Index)
+        {
+            uint32 CodePoint = Units[Index];
+            if (IsSurrogate(Units[Index]))
+            {
+                // Validated above, a high surrogate is always followed by a low one
+                CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Units[Index + 1] - 0xDC00);
+                ++Index;
+            }
+            AppendCodePoint(Chars, CodePoint);
+        }
+    }
+
+    TerminateCharArray(Chars);
+    return TResult<FString, FEncodingError>(ResultHelpers::Ok, MoveTemp(Result));
+}
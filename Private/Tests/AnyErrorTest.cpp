@@ -0,0 +1,91 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "ResultType/AnyError.h"
+#include "ResultType/Result.h"
+
+namespace
+{
+    enum class EAnyErrorTestCode : uint8
+    {
+        NotFound = 4,
+    };
+
+    struct FSmallTestError
+    {
+        int32 Code = 0;
+
+        FString GetErrorMessage() const { return TEXT("Small error"); }
+        int32 GetErrorCode() const { return Code; }
+    };
+
+    struct FLargeTestError
+    {
+        uint8 Padding[128] = {};
+        FString Message;
+
+        FString GetErrorMessage() const { return Message; }
+    };
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnyErrorStorageTest, "ResultErrorHandling.FAnyError.Storage",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAnyErrorStorageTest::RunTest(const FString& Parameters)
+{
+    // Test empty error
+    FAnyError Empty;
+    TestFalse("Default error should be unset", Empty.IsSet());
+    TestTrue("Default error message should be empty", Empty.GetErrorMessage().IsEmpty());
+
+    // Test small errors are stored inline
+    FAnyError Small(FSmallTestError{7});
+    TestTrue("Small error should be set", Small.IsSet());
+    TestTrue("Small error should be stored inline", Small.IsInline());
+    TestEqual("Small error message should match", Small.GetErrorMessage(), TEXT("Small error"));
+    TestEqual("Small error code should match", Small.GetErrorCode(), 7);
+
+    // Test large errors are boxed
+    FLargeTestError LargeSource;
+    LargeSource.Message = TEXT("Large error");
+    FAnyError Large(LargeSource);
+    TestFalse("Large error should not be stored inline", Large.IsInline());
+    TestEqual("Large error message should match", Large.GetErrorMessage(), TEXT("Large error"));
+
+    // Test copy and move
+    FAnyError Copied(Large);
+    TestEqual("Copied error message should match", Copied.GetErrorMessage(), TEXT("Large error"));
+    FAnyError Moved(MoveTemp(Copied));
+    TestFalse("Moved-from error should be unset", Copied.IsSet());
+    TestEqual("Moved error message should match", Moved.GetErrorMessage(), TEXT("Large error"));
+
+    // Test enum and string errors
+    FAnyError EnumError(EAnyErrorTestCode::NotFound);
+    TestEqual("Enum error code should be its value", EnumError.GetErrorCode(), 4);
+    FAnyError StringError(FString(TEXT("String error")));
+    TestEqual("String error message should be the string", StringError.GetErrorMessage(), TEXT("String error"));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnyErrorDowncastTest, "ResultErrorHandling.FAnyError.Downcast",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAnyErrorDowncastTest::RunTest(const FString& Parameters)
+{
+    FAnyError Error(FSmallTestError{3});
+
+    TestTrue("Is should match the stored type", Error.Is<FSmallTestError>());
+    TestFalse("Is should not match other types", Error.Is<FLargeTestError>());
+    TestNull("Downcast to other type should fail", Error.DowncastTo<FLargeTestError>());
+
+    const FSmallTestError* Small = Error.DowncastTo<FSmallTestError>();
+    TestNotNull("Downcast to stored type should succeed", Small);
+    TestEqual("Downcast value should match", Small ? Small->Code : 0, 3);
+
+    // Test usage as a TResult error
+    TResult<int32, FAnyError> Result(ResultHelpers::Err, FAnyError(FSmallTestError{9}));
+    TestTrue("Result should be Err", Result.IsErr());
+    TestEqual("Result error code should match", Result.UnwrapErr().GetErrorCode(), 9);
+
+    return true;
+}
@@ -0,0 +1,90 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/PlatformFileManager.h"
+#include "ResultType/AsyncFileReader.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAsyncFileReaderTest, "ResultErrorHandling.AsyncFileReader.Read",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAsyncFileReaderTest::RunTest(const FString& Parameters)
+{
+    TArray<uint8> Contents;
+    for (int32 Index = 0; Index < 4096; ++Index)
+    {
+        Contents.Add(static_cast<uint8>(Index * 13));
+    }
+
+    const FString Path = FPaths::CreateTempFilename(*FPaths::ProjectIntermediateDir(), TEXT("AsyncFileReaderTest"), TEXT(".bin"));
+    TestTrue("Test file should be written", FFileHelper::SaveArrayToFile(Contents, *Path));
+
+    // Readers are scoped so the file can be deleted afterwards on every platform
+    {
+        TResult<TSharedPtr<FAsyncFileReader, ESPMode::ThreadSafe>, FIoError> Opened = FAsyncFileReader::Open(Path, 2);
+        TestTrue("File should open", Opened.IsOk());
+        FAsyncFileReader& Reader = *Opened.Unwrap();
+        TestEqual("File size should be known", Reader.GetFileSize(), int64(4096));
+
+        // Test single read
+        FIoReadResult Whole = Reader.Read(FIoReadRequest{}).Get();
+        TestEqual("Whole file should be read", Whole.Unwrap().DataSize(), uint64(4096));
+        TestEqual("Data should match", Whole.Unwrap().Data()[4095], Contents[4095]);
+
+        // Test batch with more requests than in-flight slots
+        TArray<FIoReadRequest> Requests;
+        for (int32 Index = 0; Index < 8; ++Index)
+        {
+            Requests.Add(FIoReadRequest{Index * 512, 512, Index % 2 == 0 ? EIoPriority::High : EIoPriority::Low});
+        }
+        TArray<TFuture<FIoReadResult>> Futures = Reader.ReadBatch(Requests);
+        bool bAllMatch = true;
+        for (int32 Index = 0; Index < Futures.Num(); ++Index)
+        {
+            const FIoReadResult& Chunk = Futures[Index].Get();
+            bAllMatch &= Chunk.IsOk() && Chunk.Unwrap().Data()[0] == Contents[Index * 512];
+        }
+        TestTrue("Batched reads should all complete with their data", bAllMatch);
+
+        // Test structured errors
+        TestEqual("Read past the end should report ShortRead", Reader.Read(FIoReadRequest{4000, 200}).Get().UnwrapErr().Kind, EIoErrorKind::ShortRead);
+        TestEqual("Negative offset should report InvalidRange", Reader.Read(FIoReadRequest{-1, 1}).Get().UnwrapErr().Kind, EIoErrorKind::InvalidRange);
+        TestTrue("Empty read should succeed", Reader.Read(FIoReadRequest{4096, 0}).Get().IsOk());
+    }
+
+    TestEqual("Missing file should report NotFound", FAsyncFileReader::Open(Path + TEXT(".missing")).UnwrapErr().Kind, EIoErrorKind::NotFound);
+
+    FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*Path);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAsyncFileReaderReleaseTest, "ResultErrorHandling.AsyncFileReader.ReleaseFromContinuation",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAsyncFileReaderReleaseTest::RunTest(const FString& Parameters)
+{
+    TArray<uint8> Contents;
+    Contents.SetNumZeroed(1024);
+
+    const FString Path = FPaths::CreateTempFilename(*FPaths::ProjectIntermediateDir(), TEXT("AsyncFileReaderTest"), TEXT(".bin"));
+    TestTrue("Test file should be written", FFileHelper::SaveArrayToFile(Contents, *Path));
+
+    // Test a continuation holding the last reference can destroy the reader
+    {
+        TSharedPtr<FAsyncFileReader, ESPMode::ThreadSafe> Reader = FAsyncFileReader::Open(Path, 1).Unwrap();
+        TFuture<FIoReadResult> First = Reader->Read(FIoReadRequest{0, 512});
+        TFuture<FIoReadResult> Second = Reader->Read(FIoReadRequest{512, 512});
+
+        TFuture<bool> Released = Second.Next([Reader = MoveTemp(Reader)](FIoReadResult Result) mutable
+        {
+            Reader.Reset();
+            return Result.IsOk();
+        });
+        TestTrue("Reader should be destroyed without deadlocking", Released.WaitFor(5.0));
+        TestTrue("Queued read should complete before the reader is destroyed", Released.IsReady() && Released.Get());
+        TestTrue("Earlier read should complete", First.Get().IsOk());
+    }
+
+    FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*Path);
+    return true;
+}
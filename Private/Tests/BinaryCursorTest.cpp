@@ -0,0 +1,70 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "ResultType/BinaryCursor.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBinaryCursorReadTest, "ResultErrorHandling.BinaryCursor.Read",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FBinaryCursorReadTest::RunTest(const FString& Parameters)
+{
+    TArray<uint8> Buffer;
+    const uint32 Magic = 0xC0FFEE01;
+    const uint16 Version = 3;
+    Buffer.SetNumUninitialized(sizeof(Magic) + sizeof(Version));
+    FMemory::Memcpy(Buffer.GetData(), &Magic, sizeof(Magic));
+    FMemory::Memcpy(Buffer.GetData() + sizeof(Magic), &Version, sizeof(Version));
+    Buffer.Add(0xAB);
+
+    // Test typed reads
+    FBinaryCursor Cursor(Buffer);
+    TestEqual("Read should decode uint32", Cursor.Read<uint32>().Unwrap(), Magic);
+    TestEqual("Read should decode uint16", Cursor.Read<uint16>().Unwrap(), Version);
+    TestEqual("Cursor should advance", Cursor.Tell(), 6);
+
+    // Test failure leaves the cursor in place
+    TestEqual("Short read should fail at cursor", Cursor.Read<uint32>().UnwrapErr(), FDecodeError{EDecodeErrorKind::OutOfBounds, 6});
+    TestEqual("Failed read should not advance", Cursor.Tell(), 6);
+
+    // Test spans are views into the buffer
+    TResult<TArrayView<const uint8>, FDecodeError> Span = Cursor.ReadSpan(1);
+    TestTrue("Span should point into the buffer", Span.Unwrap().GetData() == Buffer.GetData() + 6);
+    TestTrue("Cursor should be at end", Cursor.IsAtEnd());
+    TestEqual("Negative span should be rejected", Cursor.ReadSpan(-1).UnwrapErr().Kind, EDecodeErrorKind::InvalidLength);
+
+    // Test batch reads
+    FBinaryCursor Batch(Buffer);
+    TResult<TTuple<uint32, uint16, uint8>, FDecodeError> Header = Batch.ReadBatch<uint32, uint16, uint8>();
+    TestTrue("Batch should read", Header.IsOk());
+    TestEqual("Batch should decode in order", Header.Unwrap().Get<1>(), Version);
+    TestEqual("Oversized batch should fail", FBinaryCursor(Buffer).ReadBatch<uint64, uint64>().UnwrapErr().Kind, EDecodeErrorKind::OutOfBounds);
+
+    uint16 Halves[3] = {};
+    TestTrue("ReadInto should fill the array", FBinaryCursor(Buffer).ReadInto(TArrayView<uint16>(Halves, 3)).IsOk());
+    TestEqual("ReadInto should copy values", Halves[2], Version);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBinaryCursorVarIntTest, "ResultErrorHandling.BinaryCursor.VarInt",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FBinaryCursorVarIntTest::RunTest(const FString& Parameters)
+{
+    const TArray<uint8> Encoded = {0x96, 0x01, 0x03, 0x05, 'a', 'b', 'c'};
+    FBinaryCursor Cursor(Encoded);
+
+    TestEqual("Two byte VarInt should decode", Cursor.ReadVarInt().Unwrap(), uint64(150));
+    TestEqual("Zigzag should decode negative", Cursor.ReadVarIntSigned().Unwrap(), int64(-2));
+    TestEqual("Sized span longer than the buffer should fail at the prefix", Cursor.ReadSizedSpan().UnwrapErr(), FDecodeError{EDecodeErrorKind::OutOfBounds, 3});
+
+    const TArray<uint8> Truncated = {0x80, 0x80};
+    TestEqual("Truncated VarInt should fail", FBinaryCursor(Truncated).ReadVarInt().UnwrapErr(), FDecodeError{EDecodeErrorKind::OutOfBounds, 0});
+
+    const TArray<uint8> TooLong = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F};
+    TestEqual("VarInt overflowing 64 bits should fail", FBinaryCursor(TooLong).ReadVarInt().UnwrapErr().Kind, EDecodeErrorKind::InvalidVarInt);
+
+    const TArray<uint8> Sized = {0x03, 'a', 'b', 'c'};
+    TestEqual("Sized span should read its payload", FBinaryCursor(Sized).ReadSizedSpan().Unwrap().Num(), 3);
+
+    return true;
+}
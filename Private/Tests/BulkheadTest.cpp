@@ -0,0 +1,183 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Async/Async.h"
+#include "HAL/PlatformProcess.h"
+#include "ResultType/AnyError.h"
+#include "ResultType/Bulkhead.h"
+
+#include <atomic>
+
+namespace
+{
+    void WaitForQueued(const FResultBulkhead& Bulkhead, int32 Count)
+    {
+        while (Bulkhead.GetMetrics().Waiting < Count)
+        {
+            FPlatformProcess::Sleep(0.0005f);
+        }
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBulkheadTest, "ResultErrorHandling.FResultBulkhead.Acquire",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FBulkheadTest::RunTest(const FString& Parameters)
+{
+    FBulkheadOptions Options;
+    Options.MaxConcurrent = 2;
+    FResultBulkhead Bulkhead(Options);
+
+    {
+        // Test permits are handed out up to the limit
+        FBulkheadPermit First = Bulkhead.TryAcquire().MoveUnwrap();
+        FBulkheadPermit Second = Bulkhead.Acquire().MoveUnwrap();
+        TestTrue("Permit should be valid", First.IsValid());
+        TestEqual("Permits should be in flight", Bulkhead.GetMetrics().InFlight, 2);
+
+        // Test callers over the limit are rejected at once when queuing is disabled
+        TResult<FBulkheadPermit, FBulkheadError> Rejected = Bulkhead.Acquire();
+        TestTrue("Full bulkhead should reject", Rejected.IsErr());
+        TestTrue("Rejection should be Saturated", Rejected.UnwrapErr().Kind == EBulkheadErrorKind::Saturated);
+        TestEqual("Error should carry the limit", Rejected.UnwrapErr().MaxConcurrent, 2);
+
+        // Test releasing a permit makes room
+        First.Reset();
+        TestTrue("Released permit should be reusable", Bulkhead.TryAcquire().IsOk());
+    }
+
+    const FBulkheadMetrics Metrics = Bulkhead.GetMetrics();
+    TestEqual("Destroyed permits should release", Metrics.InFlight, 0);
+    TestEqual("Admissions should be counted", Metrics.Admitted, static_cast<uint64>(3));
+    TestEqual("Rejections should be counted", Metrics.Saturated, static_cast<uint64>(1));
+    TestEqual("Nobody should have waited", Metrics.AdmittedAfterWait, static_cast<uint64>(0));
+
+    // Test Execute converts a rejection to the function's error type
+    FBulkheadPermit Held = Bulkhead.TryAcquire().MoveUnwrap();
+    FBulkheadPermit Other = Bulkhead.TryAcquire().MoveUnwrap();
+    TResult<int32, FAnyError> Skipped = Bulkhead.Execute([]() { return TResult<int32, FAnyError>(ResultHelpers::Ok, 1); });
+    TestTrue("Execute should report the rejection", Skipped.IsErr() && Skipped.UnwrapErr().Is<FBulkheadError>());
+    Other.Reset();
+    TResult<int32, FAnyError> Ran = Bulkhead.Execute([&Bulkhead]()
+    {
+        return TResult<int32, FAnyError>(ResultHelpers::Ok, Bulkhead.GetMetrics().InFlight);
+    });
+    TestEqual("Execute should run under a permit", Ran.Unwrap(), 2);
+    TestEqual("Execute should release its permit", Bulkhead.GetMetrics().InFlight, 1);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBulkheadWaitTest, "ResultErrorHandling.FResultBulkhead.Wait",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FBulkheadWaitTest::RunTest(const FString& Parameters)
+{
+    FBulkheadOptions Options;
+    Options.MaxConcurrent = 1;
+    Options.MaxWaiting = 3;
+    Options.MaxWaitMs = 5000;
+    FResultBulkhead Bulkhead(Options);
+
+    // Test queued callers are admitted in arrival order as permits are released
+    FBulkheadPermit Held = Bulkhead.Acquire().MoveUnwrap();
+    FCriticalSection OrderLock;
+    TArray<int32> Order;
+    TArray<TFuture<bool>> Waiters;
+    for (int32 Index = 0; Index < 3; ++Index)
+    {
+        Waiters.Add(Async(EAsyncExecution::Thread, [&Bulkhead, &OrderLock, &Order, Index]()
+        {
+            TResult<FBulkheadPermit, FBulkheadError> Permit = Bulkhead.Acquire();
+            if (Permit.IsOk())
+            {
+                FScopeLock ScopeLock(&OrderLock);
+                Order.Add(Index);
+            }
+            return Permit.IsOk();
+        }));
+        WaitForQueued(Bulkhead, Index + 1);
+    }
+
+    // Test a full queue rejects instead of waiting
+    TResult<FBulkheadPermit, FBulkheadError> Overflow = Bulkhead.Acquire();
+    TestTrue("Full queue should reject", Overflow.IsErr() && Overflow.UnwrapErr().Kind == EBulkheadErrorKind::Saturated);
+    TestEqual("Error should carry the queue length", Overflow.UnwrapErr().Waiting, 3);
+    TestTrue("TryAcquire should not jump the queue", Bulkhead.TryAcquire().IsErr());
+
+    Held.Reset();
+    for (TFuture<bool>& Waiter : Waiters)
+    {
+        TestTrue("Queued caller should be admitted", Waiter.Get());
+    }
+    TestEqual("Every queued caller should run", Order.Num(), 3);
+    TestTrue("Callers should run in arrival order", Order.Num() == 3 && Order[0] == 0 && Order[1] == 1 && Order[2] == 2);
+
+    FBulkheadMetrics Metrics = Bulkhead.GetMetrics();
+    TestEqual("Waited admissions should be counted", Metrics.AdmittedAfterWait, static_cast<uint64>(3));
+    TestTrue("Wait time should be measured", Metrics.MaxWaitSeconds > 0.0 && Metrics.TotalWaitSeconds >= Metrics.MaxWaitSeconds);
+
+    // Test a queued caller gives up after the wait limit
+    FBulkheadOptions ShortOptions = Options;
+    ShortOptions.MaxWaitMs = 10;
+    FResultBulkhead Short(ShortOptions);
+    FBulkheadPermit Busy = Short.Acquire().MoveUnwrap();
+    TResult<FBulkheadPermit, FBulkheadError> Late = Short.Acquire();
+    TestTrue("Wait should time out", Late.IsErr() && Late.UnwrapErr().Kind == EBulkheadErrorKind::TimedOut);
+    Metrics = Short.GetMetrics();
+    TestEqual("Timeouts should be counted", Metrics.TimedOut, static_cast<uint64>(1));
+    TestEqual("Timed out caller should leave the queue", Metrics.Waiting, 0);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBulkheadConcurrencyTest, "ResultErrorHandling.FResultBulkhead.Concurrency",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FBulkheadConcurrencyTest::RunTest(const FString& Parameters)
+{
+    FBulkheadOptions Options;
+    Options.MaxConcurrent = 3;
+    Options.MaxWaiting = 4;
+    Options.MaxWaitMs = 1;
+    FResultBulkhead Bulkhead(Options);
+
+    // Test the limit holds under contention and every call is either admitted or rejected
+    std::atomic<int32> Running{0};
+    std::atomic<int32> Overruns{0};
+    std::atomic<int32> Succeeded{0};
+    std::atomic<int32> Failed{0};
+    constexpr int32 NumThreads = 8;
+    constexpr int32 CallsPerThread = 2000;
+
+    TArray<TFuture<void>> Workers;
+    for (int32 Thread = 0; Thread < NumThreads; ++Thread)
+    {
+        Workers.Add(Async(EAsyncExecution::Thread, [&]()
+        {
+            for (int32 Index = 0; Index < CallsPerThread; ++Index)
+            {
+                TVoidResult<FAnyError> Result = Bulkhead.Execute([&]()
+                {
+                    Overruns += Running.fetch_add(1) >= 3 ? 1 : 0;
+                    FPlatformProcess::YieldThread();
+                    Running.fetch_sub(1);
+                    return TVoidResult<FAnyError>(ResultHelpers::Ok, ResultHelpers::Unit);
+                });
+                ++(Result.IsOk() ? Succeeded : Failed);
+            }
+        }));
+    }
+    for (TFuture<void>& Worker : Workers)
+    {
+        Worker.Wait();
+    }
+
+    const FBulkheadMetrics Metrics = Bulkhead.GetMetrics();
+    TestEqual("Limit should never be exceeded", Overruns.load(), 0);
+    TestEqual("Every call should be accounted for", Succeeded.load() + Failed.load(), NumThreads * CallsPerThread);
+    TestEqual("Admissions should match successful calls", Metrics.Admitted, static_cast<uint64>(Succeeded.load()));
+    TestEqual("Rejections should match failed calls", Metrics.Saturated + Metrics.TimedOut, static_cast<uint64>(Failed.load()));
+    TestEqual("Every permit should be returned", Metrics.InFlight, 0);
+    TestEqual("Queue should be empty", Metrics.Waiting, 0);
+    return true;
+}
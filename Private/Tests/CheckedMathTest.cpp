@@ -0,0 +1,63 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "ResultType/CheckedMath.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCheckedMathScalarTest, "ResultErrorHandling.CheckedMath.Scalar",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FCheckedMathScalarTest::RunTest(const FString& Parameters)
+{
+    // Test CheckedAdd
+    TestEqual("CheckedAdd in range should return the sum", CheckedAdd<int32>(2, 3).Unwrap(), 5);
+    TestTrue("CheckedAdd overflow should be Err", CheckedAdd<int32>(MAX_int32, 1).IsErr());
+    TestTrue("CheckedAdd negative overflow should be Err", CheckedAdd<int32>(MIN_int32, -1).IsErr());
+    TestTrue("CheckedAdd unsigned wrap should be Err", CheckedAdd<uint8>(200, 100).IsErr());
+
+    // Test CheckedMul
+    TestEqual("CheckedMul in range should return the product", CheckedMul<int64>(-4, 5).Unwrap(), static_cast<int64>(-20));
+    TestTrue("CheckedMul overflow should be Err", CheckedMul<int32>(65536, 65536).IsErr());
+    TestTrue("CheckedMul overflow error should be Overflow", CheckedMul<int32>(65536, 65536).UnwrapErr() == EArithError::Overflow);
+
+    // Test CheckedNarrow
+    TestEqual("CheckedNarrow in range should keep the value", CheckedNarrow<uint8>(255).Unwrap(), static_cast<uint8>(255));
+    TestTrue("CheckedNarrow out of range should be Err", CheckedNarrow<uint8>(256).IsErr());
+    TestTrue("CheckedNarrow negative to unsigned should be Err", CheckedNarrow<uint32>(-1).IsErr());
+    TestTrue("CheckedNarrow large unsigned to signed should be Err", CheckedNarrow<int32>(3000000000u).IsErr());
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCheckedMathBatchTest, "ResultErrorHandling.CheckedMath.Batch",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FCheckedMathBatchTest::RunTest(const FString& Parameters)
+{
+    TArray<int32> A = { 1, 2, MAX_int32, 4, MAX_int32 };
+    TArray<int32> B = { 1, 2, 1, 4, 1 };
+    TArray<int32> Out;
+    Out.SetNum(A.Num());
+
+    // Test batch overflow reports the first failing index
+    TVoidResult<FArithBatchError> Added = CheckedAddBatch<int32>(A, B, Out);
+    TestTrue("Overflowing batch should be Err", Added.IsErr());
+    TestEqual("Overflowing batch should report the first index", Added.UnwrapErr().Index, 2);
+    TestEqual("Batch should still write valid elements", Out[3], 8);
+
+    // Test clean batch
+    TArray<int32> Small = { 3, 4, 5, 6, 7 };
+    TestTrue("Clean batch should be Ok", CheckedMulBatch<int32>(Small, Small, Out).IsOk());
+    TestEqual("Clean batch should write products", Out[4], 49);
+
+    // Test size mismatch
+    TArray<int32> Short = { 1 };
+    TestTrue("Mismatched sizes should be Err", CheckedAddBatch<int32>(A, Short, Out).IsErrAnd([](const FArithBatchError& Error) { return Error.Error == EArithError::SizeMismatch; }));
+
+    // Test narrowing batch
+    TArray<int32> Wide = { 1, 300, -1 };
+    TArray<uint8> Narrow;
+    Narrow.SetNum(Wide.Num());
+    TVoidResult<FArithBatchError> Narrowed = CheckedNarrowBatch<uint8, int32>(Wide, Narrow);
+    TestEqual("Narrowing batch should report the first lossy index", Narrowed.UnwrapErr().Index, 1);
+
+    return true;
+}
@@ -0,0 +1,115 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "ResultType/CompactBinaryResult.h"
+
+namespace
+{
+    enum class ECacheMiss : uint8
+    {
+        NotFound = 1,
+        Expired = 2,
+    };
+
+    /** Error with a payload, written as its own object */
+    struct FBuildError
+    {
+        int32 Code = 0;
+        FString Step;
+
+        int32 GetErrorCode() const { return Code; }
+
+        bool operator==(const FBuildError& Other) const
+        {
+            return Code == Other.Code && Step == Other.Step;
+        }
+    };
+
+    FCbWriter& operator<<(FCbWriter& Writer, const FBuildError& Error)
+    {
+        Writer.BeginObject();
+        Writer.SetName(UTF8TEXTVIEW("step")) << Error.Step;
+        Writer.EndObject();
+        return Writer;
+    }
+
+    bool LoadFromCompactBinary(FCbFieldView Field, FBuildError& OutError)
+    {
+        return LoadFromCompactBinary(Field.AsObjectView()[UTF8TEXTVIEW("step")], OutError.Step);
+    }
+
+    template<typename T, typename E>
+    FCbField SaveResult(const TResult<T, E>& Result)
+    {
+        FCbWriter Writer;
+        Writer << Result;
+        return Writer.Save();
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCompactBinaryResultTest, "ResultErrorHandling.CompactBinary.RoundTrip",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FCompactBinaryResultTest::RunTest(const FString& Parameters)
+{
+    // Test an Ok value round trips
+    const FCbField Ok = SaveResult(TResult<int32, ECacheMiss>(ResultHelpers::Ok, 42));
+    FCbResultView OkView(Ok);
+    TestTrue("Stored result should be valid", OkView.IsValid());
+    TestTrue("Tag should be Ok", OkView.IsOk());
+    TestEqual("Value should be readable in place", OkView.GetValueView().AsInt32(), 42);
+    TestEqual("Ok result should have no error code", OkView.GetErrorCode(), 0);
+    TestEqual("Value should load", OkView.Load<int32, ECacheMiss>()->Unwrap(), 42);
+
+    // Test an enum error is stored as its code only
+    const FCbField Miss = SaveResult(TResult<int32, ECacheMiss>(ResultHelpers::Err, ECacheMiss::Expired));
+    FCbResultView MissView(Miss);
+    TestTrue("Tag should be Err", MissView.IsErr());
+    TestEqual("Error code should be stored", MissView.GetErrorCode(), 2);
+    TestFalse("Enum error should have no payload", MissView.GetErrorView().HasValue());
+    TResult<int32, ECacheMiss> LoadedMiss(ResultHelpers::Ok, 0);
+    TestTrue("Error should load", LoadFromCompactBinary(Miss, LoadedMiss));
+    TestTrue("Loaded error should match", LoadedMiss.IsErr() && LoadedMiss.UnwrapErr() == ECacheMiss::Expired);
+
+    // Test an error payload round trips and its code is readable without the error type
+    const FCbField Failed = SaveResult(TResult<FString, FBuildError>(ResultHelpers::Err, FBuildError{7, TEXT("Compress")}));
+    FCbResultView FailedView(Failed);
+    TestEqual("Code should be readable without loading", FailedView.GetErrorCode(), 7);
+    TOptional<TResult<FString, FBuildError>> LoadedFailure = FailedView.Load<FString, FBuildError>();
+    TestTrue("Error payload should load", LoadedFailure.IsSet() && LoadedFailure->IsErr());
+    TestEqual("Error payload should match", LoadedFailure->UnwrapErr().Step, FString(TEXT("Compress")));
+
+    // Test void results store only the tag
+    const FCbField Done = SaveResult(TVoidResult<ECacheMiss>(ResultHelpers::Ok, ResultHelpers::Unit));
+    TestFalse("Void result should have no value", FCbResultView(Done).GetValueView().HasValue());
+    TestTrue("Void result should load", FCbResultView(Done).Load<ResultHelpers::FUnit, ECacheMiss>()->IsOk());
+
+    // Test identical outcomes hash alike
+    const FCbField OkAgain = SaveResult(TResult<int32, ECacheMiss>(ResultHelpers::Ok, 42));
+    TestTrue("Identical results should hash alike", FCbResultView(OkAgain).GetHash() == OkView.GetHash());
+    TestTrue("Different results should hash apart", MissView.GetHash() != OkView.GetHash());
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCompactBinaryResultInvalidTest, "ResultErrorHandling.CompactBinary.Invalid",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FCompactBinaryResultInvalidTest::RunTest(const FString& Parameters)
+{
+    // Test a field that is not a result
+    FCbWriter Writer;
+    Writer.BeginObject();
+    Writer.AddInteger(UTF8TEXTVIEW("t"), 9);
+    Writer.EndObject();
+    const FCbField Unknown = Writer.Save();
+    TestFalse("Unknown tag should be invalid", FCbResultView(Unknown).IsValid());
+    TestFalse("Unknown tag should not load", FCbResultView(Unknown).Load<int32, ECacheMiss>().IsSet());
+
+    // Test a value stored under another type does not load
+    const FCbField Text = SaveResult(TResult<FString, ECacheMiss>(ResultHelpers::Ok, FString(TEXT("Chunk"))));
+    TResult<int32, ECacheMiss> Mismatched(ResultHelpers::Err, ECacheMiss::NotFound);
+    TestFalse("Mismatched value type should fail to load", LoadFromCompactBinary(Text, Mismatched));
+    TestTrue("Failed load should leave the output untouched", Mismatched.IsErr());
+
+    return true;
+}
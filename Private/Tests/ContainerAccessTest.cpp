@@ -0,0 +1,71 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "ResultType/ContainerAccess.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FContainerAccessArrayTest, "ResultErrorHandling.ContainerAccess.Array",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FContainerAccessArrayTest::RunTest(const FString& Parameters)
+{
+    TArray<int32> Array = { 1, 2, 3 };
+
+    // Test TryGet returns a reference to the element
+    TResult<int32&, ELookupError> Found = TryGet(Array, 1);
+    TestTrue("TryGet in range should be Ok", Found.IsOk());
+    Found.Unwrap() = 20;
+    TestEqual("TryGet should reference the element in place", Array[1], 20);
+
+    // Test TryGet out of range
+    TResult<int32&, ELookupError> Missing = TryGet(Array, 3);
+    TestTrue("TryGet out of range should be Err", Missing.IsErr());
+    TestTrue("TryGet out of range error should be OutOfRange", Missing.UnwrapErr() == ELookupError::OutOfRange);
+
+    // Test const access
+    const TArray<int32>& ConstArray = Array;
+    TResult<const int32&, ELookupError> ConstFound = TryGet(ConstArray, 0);
+    TestEqual("Const TryGet value should match", ConstFound.Unwrap(), 1);
+
+    // Test TryPop
+    TestEqual("TryPop should return the last element", TryPop(Array).Unwrap(), 3);
+    Array.Empty();
+    TestTrue("TryPop on empty array should be Err", TryPop(Array).IsErrAnd([](ELookupError Error) { return Error == ELookupError::Empty; }));
+
+    // Test TSparseArray
+    TSparseArray<int32> Sparse;
+    const int32 SparseIndex = Sparse.Add(7);
+    TestEqual("Sparse TryGet value should match", TryGet(Sparse, SparseIndex).Unwrap(), 7);
+    TestTrue("Sparse TryGet invalid index should be Err", TryGet(Sparse, SparseIndex + 1).IsErr());
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FContainerAccessMapSetTest, "ResultErrorHandling.ContainerAccess.MapSet",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FContainerAccessMapSetTest::RunTest(const FString& Parameters)
+{
+    TMap<FString, int32> Map;
+    Map.Add(TEXT("Health"), 100);
+
+    // Test TryFind on TMap
+    TResult<int32&, ELookupError> Health = TryFind(Map, TEXT("Health"));
+    TestTrue("TryFind existing key should be Ok", Health.IsOk());
+    Health.Unwrap() -= 25;
+    TestEqual("TryFind should reference the value in place", *Map.Find(TEXT("Health")), 75);
+
+    TResult<int32&, ELookupError> Mana = TryFind(Map, TEXT("Mana"));
+    TestTrue("TryFind missing key should be Err", Mana.IsErr());
+    TestTrue("TryFind missing key error should be NotFound", Mana.UnwrapErr() == ELookupError::NotFound);
+
+    // Test TryFind on TSet
+    TSet<FName> Tags;
+    Tags.Add(TEXT("Player"));
+    TestTrue("TryFind existing element should be Ok", TryFind(Tags, FName(TEXT("Player"))).IsOk());
+    TestTrue("TryFind missing element should be Err", TryFind(Tags, FName(TEXT("Enemy"))).IsErr());
+
+    // Test Map on reference results
+    auto Doubled = TryFind(Map, TEXT("Health")).Map([](int32 Value) { return Value * 2; });
+    TestEqual("Map should read through the reference", Doubled.Unwrap(), 150);
+
+    return true;
+}
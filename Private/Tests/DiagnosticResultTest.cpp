@@ -0,0 +1,70 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "ResultType/DiagnosticResult.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTDiagnosticResultConstructorTest, "ResultErrorHandling.TDiagnosticResult.Constructor",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FTDiagnosticResultConstructorTest::RunTest(const FString& Parameters)
+{
+    // Test result without diagnostics
+    TDiagnosticResult<int32, FString> Clean(ResultHelpers::Ok, 42);
+    TestTrue("Clean result should be Ok", Clean.IsOk());
+    TestFalse("Clean result should have no diagnostics", Clean.HasDiagnostics());
+
+    // Test recording diagnostics
+    TDiagnosticResult<int32, FString> Warned(ResultHelpers::Ok, 42);
+    Warned.Warn(TEXT("Deprecated field")).Note(TEXT("Using defaults"));
+    TestTrue("Warned result should be Ok", Warned.IsOk());
+    TestEqual("Warned result should have two diagnostics", Warned.GetDiagnostics().Num(), 2);
+    TestTrue("Warned result should have warnings", Warned.HasWarnings());
+    TestEqual("First diagnostic message should match", Warned.GetDiagnostics()[0].Message, TEXT("Deprecated field"));
+
+    // Test conversion to plain result
+    TResult<int32, FString> Plain = Warned.ToResult();
+    TestEqual("Plain result value should match", Plain.Unwrap(), 42);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTDiagnosticResultPropagationTest, "ResultErrorHandling.TDiagnosticResult.Propagation",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FTDiagnosticResultPropagationTest::RunTest(const FString& Parameters)
+{
+    TDiagnosticResult<int32, FString> Source(ResultHelpers::Ok, 5);
+    Source.Warn(TEXT("First"));
+
+    // Test Map keeps diagnostics
+    auto Mapped = Source.Map([](int32 Val) { return Val * 2; });
+    TestEqual("Mapped value should be transformed", Mapped.Unwrap(), 10);
+    TestEqual("Map should keep diagnostics", Mapped.GetDiagnostics().Num(), 1);
+
+    // Test AndThen merges diagnostics of chained results
+    auto Chained = Source.AndThen([](int32 Val) {
+        TDiagnosticResult<int32, FString> Next(ResultHelpers::Ok, Val + 1);
+        Next.Warn(TEXT("Second"));
+        return Next;
+    });
+    TestEqual("Chained value should match", Chained.Unwrap(), 6);
+    TestEqual("AndThen should merge diagnostics", Chained.GetDiagnostics().Num(), 2);
+    TestEqual("Merged diagnostics should keep order", Chained.GetDiagnostics()[1].Message, TEXT("Second"));
+
+    // Test AndThen accepts plain results
+    auto ChainedPlain = Source.AndThen([](int32 Val) {
+        return TResult<int32, FString>(ResultHelpers::Err, TEXT("Failed"));
+    });
+    TestTrue("Chained plain result should be Err", ChainedPlain.IsErr());
+    TestEqual("Err should keep diagnostics", ChainedPlain.GetDiagnostics().Num(), 1);
+
+    // Test Err short-circuits but keeps diagnostics
+    TDiagnosticResult<int32, FString> Failed(ResultHelpers::Err, TEXT("Error"));
+    Failed.Warn(TEXT("Before failure"));
+    auto FailedChain = Failed.AndThen([](int32 Val) {
+        return TResult<int32, FString>(ResultHelpers::Ok, Val);
+    });
+    TestTrue("Failed chain should remain Err", FailedChain.IsErr());
+    TestEqual("Failed chain should keep diagnostics", FailedChain.GetDiagnostics().Num(), 1);
+
+    return true;
+}
@@ -0,0 +1,92 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Async/Async.h"
+#include "ResultType/ErrorAggregator.h"
+#include "ResultType/Result.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FErrorAggregatorTest, "ResultErrorHandling.ErrorAggregator.Frame",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FErrorAggregatorTest::RunTest(const FString& Parameters)
+{
+    FErrorAggregator Aggregator;
+    static const FErrorSite LoadSite{__FILE__, __LINE__};
+    static const FErrorSite DecodeSite{__FILE__, __LINE__};
+
+    // Test errors from several threads are merged per site and code
+    TArray<TFuture<void>> Workers;
+    for (int32 Thread = 0; Thread < 4; ++Thread)
+    {
+        Workers.Add(Async(EAsyncExecution::Thread, [&Aggregator]()
+        {
+            for (int32 Index = 0; Index < 250; ++Index)
+            {
+                Aggregator.Record(LoadSite, 404);
+                if (Index % 10 == 0)
+                {
+                    Aggregator.Record(DecodeSite, FString(TEXT("Bad header")));
+                }
+            }
+        }));
+    }
+    for (TFuture<void>& Worker : Workers)
+    {
+        Worker.Wait();
+    }
+
+    FErrorFrameReport Report = Aggregator.EndFrame();
+    TestEqual("Report should be for the first frame", Report.FrameIndex, uint64(0));
+    TestEqual("Every error should be counted", Report.TotalCount, 1100);
+    TestEqual("Errors should be merged per site and code", Report.Entries.Num(), 2);
+    TestEqual("Most frequent error should come first", Report.Entries[0].Count, 1000);
+    TestEqual("Code should be kept", Report.Entries[0].Code, 404);
+    TestEqual("Every thread should be counted", Report.Entries[0].ThreadCount, 4);
+    TestEqual("First error should be kept", Report.Entries[1].FirstError.GetErrorMessage(), FString(TEXT("Bad header")));
+
+    // Test the next frame starts empty
+    TResult<int32, int32>(ResultHelpers::Err, 3).InspectErr(RESULT_AGGREGATE_ERR(Aggregator));
+    FErrorFrameReport Next = Aggregator.EndFrame();
+    TestEqual("Frame index should advance", Next.FrameIndex, uint64(1));
+    TestEqual("Only the new error should be reported", Next.TotalCount, 1);
+    TestEqual("Empty frame should have no entries", Aggregator.EndFrame().Entries.Num(), 0);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FErrorAggregatorThreadExitTest, "ResultErrorHandling.ErrorAggregator.ThreadExit",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FErrorAggregatorThreadExitTest::RunTest(const FString& Parameters)
+{
+    FErrorAggregator Aggregator;
+    static const FErrorSite Site{__FILE__, __LINE__};
+
+    // Test short-lived threads each get a buffer while they run
+    TArray<TFuture<void>> Workers;
+    for (int32 Thread = 0; Thread < 8; ++Thread)
+    {
+        Workers.Add(Async(EAsyncExecution::Thread, [&Aggregator]() { Aggregator.Record(Site, 500); }));
+    }
+    for (TFuture<void>& Worker : Workers)
+    {
+        Worker.Wait();
+    }
+
+    // Test buffers of exited threads are dropped once their last entries are reported, threads may still be winding down
+    int32 Reported = 0;
+    const double Deadline = FPlatformTime::Seconds() + 10.0;
+    do
+    {
+        Reported += Aggregator.EndFrame().TotalCount;
+    }
+    while (Aggregator.GetThreadBufferCount() > 0 && FPlatformTime::Seconds() < Deadline);
+    TestEqual("Every error should be reported", Reported, 8);
+    TestEqual("Buffers of exited threads should be dropped", Aggregator.GetThreadBufferCount(), 0);
+
+    // Test a thread that keeps recording keeps its buffer
+    Aggregator.Record(Site, 500);
+    Aggregator.EndFrame();
+    TestEqual("Live thread should keep its buffer", Aggregator.GetThreadBufferCount(), 1);
+
+    return true;
+}
@@ -0,0 +1,85 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/ScopeLock.h"
+#include "ResultType/ErrorLog.h"
+#include "ResultType/Result.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FErrorLogSinkTest, "ResultErrorHandling.ErrorLog.Sink",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FErrorLogSinkTest::RunTest(const FString& Parameters)
+{
+    FCriticalSection Lock;
+    TArray<FErrorLogEntry> Entries;
+    FErrorLogSink Sink([&Lock, &Entries](const FErrorLogEntry& Entry)
+    {
+        FScopeLock ScopeLock(&Lock);
+        Entries.Add(Entry);
+    }, 10.0f);
+
+    // Test identical consecutive errors are merged into one entry
+    FErrorLogSite Site(__FILE__, __LINE__, 0.0f);
+    for (int32 Index = 0; Index < 1000; ++Index)
+    {
+        Sink.Submit(Site, FString(TEXT("Texture missing")));
+    }
+    Sink.Submit(Site, FString(TEXT("Mesh missing")));
+    Sink.Flush();
+
+    FScopeLock ScopeLock(&Lock);
+    TestEqual("Storm should produce two entries", Entries.Num(), 2);
+    TestEqual("Repeats should be counted", Entries[0].Repeats, 1000);
+    TestEqual("Message should be formatted on the sink thread", Entries[0].Message, FString(TEXT("Texture missing")));
+    TestEqual("Different error should start a new entry", Entries[1].Repeats, 1);
+    TestTrue("Entry should point at its site", Entries[1].Site == &Site);
+
+    // Test the InspectErr adaptor reaches the shared sink, the expected error fails the test unless it is logged once
+    AddExpectedError(TEXT("Shader compile failed"), EAutomationExpectedErrorFlags::Contains, 1);
+    TResult<int32, FString>(ResultHelpers::Err, FString(TEXT("Shader compile failed"))).InspectErr(RESULT_LOG_ERR(1.0f, 1));
+    FErrorLogSink::Get().Flush();
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FErrorLogRateLimitTest, "ResultErrorHandling.ErrorLog.RateLimit",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FErrorLogRateLimitTest::RunTest(const FString& Parameters)
+{
+    // Test the bucket allows the burst and then suppresses
+    FErrorLogSite Site(__FILE__, __LINE__, 0.001f, 5);
+    int32 Accepted = 0;
+    for (int32 Index = 0; Index < 100; ++Index)
+    {
+        Accepted += Site.TryAcquire() ? 1 : 0;
+    }
+    TestEqual("Only the burst should pass", Accepted, 5);
+    TestEqual("Suppressed records should be counted", Site.TakeSuppressedCount(), 95);
+    TestEqual("Suppressed count should reset once taken", Site.TakeSuppressedCount(), 0);
+
+    // Test suppressed counts travel with the next accepted record
+    TArray<FErrorLogEntry> Entries;
+    {
+        FErrorLogSink Sink([&Entries](const FErrorLogEntry& Entry) { Entries.Add(Entry); }, 0.0f);
+        FErrorLogSite Limited(__FILE__, __LINE__, 0.001f, 1);
+        Sink.Submit(Limited, 7);
+        Sink.Submit(Limited, 7);
+        Sink.Submit(Limited, 7);
+    }
+    TestEqual("Only one record should pass the limit", Entries.Num(), 1);
+    TestEqual("Integer error should keep its code", Entries[0].Code, 7);
+
+    // Test stopping writes what is queued and drops later submissions
+    TArray<FErrorLogEntry> Stopped;
+    FErrorLogSink Sink([&Stopped](const FErrorLogEntry& Entry) { Stopped.Add(Entry); }, 10.0f);
+    FErrorLogSite Unlimited(__FILE__, __LINE__, 0.0f);
+    Sink.Submit(Unlimited, 3);
+    Sink.Stop();
+    TestEqual("Queued error should be written by Stop", Stopped.Num(), 1);
+    Sink.Submit(Unlimited, 4);
+    Sink.Flush();
+    TestEqual("Error submitted after Stop should be dropped", Stopped.Num(), 1);
+
+    return true;
+}
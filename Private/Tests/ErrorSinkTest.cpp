@@ -0,0 +1,56 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "ResultType/ErrorSink.h"
+
+namespace
+{
+    float SafeReciprocal(float Value)
+    {
+        const bool bFailed = Value == 0.0f;
+        TErrorSink<FString>::ReportIf(bFailed, [] { return FString(TEXT("Division by zero")); });
+        return bFailed ? 0.0f : 1.0f / Value;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTErrorSinkScopeTest, "ResultErrorHandling.TErrorSink.Scope",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FTErrorSinkScopeTest::RunTest(const FString& Parameters)
+{
+    // Test kernel without failures
+    {
+        TErrorSinkScope<FString> Scope;
+        float Sum = SafeReciprocal(2.0f) + SafeReciprocal(4.0f);
+        TResult<float, FString> Result = Scope.Finish(Sum);
+        TestTrue("Clean kernel should be Ok", Result.IsOk());
+        TestEqual("Clean kernel value should match", Result.Unwrap(), 0.75f);
+    }
+
+    // Test kernel with failures keeps the first error and counts all of them
+    {
+        TErrorSinkScope<FString> Scope;
+        float Sum = SafeReciprocal(0.0f) + SafeReciprocal(2.0f) + SafeReciprocal(0.0f);
+        TestEqual("Sink should count every failure", Scope.GetErrorCount(), 2);
+        TResult<float, FString> Result = Scope.Finish(Sum);
+        TestTrue("Failing kernel should be Err", Result.IsErr());
+        TestEqual("Failing kernel error should match", Result.UnwrapErr(), TEXT("Division by zero"));
+        TestFalse("Finish should clear the sink", Scope.HasErrors());
+    }
+
+    // Test nested scopes restore the outer state
+    {
+        TErrorSinkScope<FString> Outer;
+        TErrorSink<FString>::Report(TEXT("Outer"));
+        {
+            TErrorSinkScope<FString> Inner;
+            TestFalse("Inner scope should start empty", Inner.HasErrors());
+        }
+        TestEqual("Outer scope should be restored", Outer.GetErrorCount(), 1);
+    }
+
+    // Test CaptureErrors helper
+    auto Captured = ResultHelpers::CaptureErrors<FString>([] { return SafeReciprocal(0.0f); });
+    TestTrue("CaptureErrors should return Err", Captured.IsErr());
+
+    return true;
+}
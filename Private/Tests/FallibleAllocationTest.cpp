@@ -0,0 +1,67 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "ResultType/FallibleAllocation.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFallibleMemoryTest, "ResultErrorHandling.FallibleAllocation.Memory",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFallibleMemoryTest::RunTest(const FString& Parameters)
+{
+    // Test TryMalloc success
+    TResult<void*, EAllocError> Allocation = FFallibleMemory::TryMalloc(256);
+    TestTrue("TryMalloc should succeed", Allocation.IsOk());
+    TestNotNull("TryMalloc should return memory", Allocation.Unwrap());
+    FMemory::Free(Allocation.Unwrap());
+
+    // Test emergency reserve lifecycle
+    FFallibleMemory::InitEmergencyReserve(64 * 1024);
+    TestTrue("Emergency reserve should be held", FFallibleMemory::HasEmergencyReserve());
+    TestTrue("Releasing the reserve should report it was held", FFallibleMemory::ReleaseEmergencyReserve());
+    TestFalse("Emergency reserve should be released", FFallibleMemory::HasEmergencyReserve());
+    TestFalse("Releasing twice should report nothing was held", FFallibleMemory::ReleaseEmergencyReserve());
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFallibleContainerTest, "ResultErrorHandling.FallibleAllocation.Containers",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFallibleContainerTest::RunTest(const FString& Parameters)
+{
+    // Test TryReserve and TryAdd on TArray
+    TArray<int32> Array;
+    TestTrue("TryReserve should succeed", TryReserve(Array, 32).IsOk());
+    TestTrue("TryReserve should grow capacity", Array.Max() >= 32);
+    TestTrue("TryReserve with negative size should fail", TryReserve(Array, -1).IsErrAnd([](EAllocError Error) { return Error == EAllocError::InvalidSize; }));
+
+    TResult<int32, EAllocError> Added = TryAdd(Array, 5);
+    TestEqual("TryAdd should return the new index", Added.Unwrap(), 0);
+    TestEqual("TryAdd should store the item", Array[0], 5);
+
+    TResult<int32, EAllocError> Uninitialized = TryAddUninitialized(Array, 3);
+    TestEqual("TryAddUninitialized should return the first new index", Uninitialized.Unwrap(), 1);
+    TestEqual("TryAddUninitialized should grow Num", Array.Num(), 4);
+
+    TestTrue("TryResize should succeed", TryResize(Array, 100).IsOk());
+    TestEqual("TryResize should set Num", Array.Num(), 100);
+
+    // Test TryAdd on TMap
+    TMap<FString, int32> Map;
+    TResult<int32&, EAllocError> Value = TryAdd(Map, FString(TEXT("Key")), 7);
+    TestTrue("Map TryAdd should succeed", Value.IsOk());
+    Value.Unwrap() = 8;
+    TestEqual("Map TryAdd should reference the stored value", *Map.Find(TEXT("Key")), 8);
+    TestTrue("Map TryReserve should succeed", TryReserve(Map, 64).IsOk());
+
+    // Test only heap allocators are probed, inline storage grows without a probe
+    TestTrue("Default allocator should be probed", ResultHelpers::TIsHeapAllocator<FDefaultAllocator>::Value);
+    TestFalse("Inline allocator should not be probed", ResultHelpers::TIsHeapAllocator<TInlineAllocator<8>>::Value);
+    TArray<int32, TInlineAllocator<8>> Inline;
+    TestTrue("Inline TryReserve should succeed", TryReserve(Inline, 4).IsOk());
+    TestTrue("Inline TryAdd should succeed", TryAdd(Inline, 1).IsOk());
+
+    // Test a growth whose old and new blocks cannot both exist is rejected
+    TestTrue("Probe size overflow should fail", ResultHelpers::ProbeGrowth(TNumericLimits<SIZE_T>::Max(), 1, alignof(int32)).IsErrAnd([](EAllocError Error) { return Error == EAllocError::InvalidSize; }));
+
+    return true;
+}
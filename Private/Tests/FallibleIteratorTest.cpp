@@ -0,0 +1,145 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "ResultType/BinaryCursor.h"
+#include "ResultType/FallibleIterator.h"
+#include "ResultType/ResultStream.h"
+
+namespace
+{
+    /** Decodes one uint32 record at a time, a trailing partial record is a decode error */
+    struct FRecordReader
+    {
+        explicit FRecordReader(TArrayView<const uint8> Bytes)
+            : Cursor(Bytes)
+        {
+        }
+
+        TResult<TOptional<uint32>, FDecodeError> TryNext()
+        {
+            if (Cursor.IsAtEnd())
+            {
+                return TResult<TOptional<uint32>, FDecodeError>(ResultHelpers::Ok, TOptional<uint32>());
+            }
+
+            TResult<uint32, FDecodeError> Record = Cursor.Read<uint32>();
+            if (Record.IsErr())
+            {
+                return TResult<TOptional<uint32>, FDecodeError>(ResultHelpers::Err, Record.UnwrapErr());
+            }
+            ++Decoded;
+            return TResult<TOptional<uint32>, FDecodeError>(ResultHelpers::Ok, TOptional<uint32>(Record.Unwrap()));
+        }
+
+        FBinaryCursor Cursor;
+        int32 Decoded = 0;
+    };
+
+    TArray<uint8> EncodeRecords(int32 Count, int32 TrailingBytes = 0)
+    {
+        TArray<uint8> Bytes;
+        for (uint32 Record = 1; Record <= static_cast<uint32>(Count); ++Record)
+        {
+            const int32 Offset = Bytes.AddUninitialized(sizeof(uint32));
+            FMemory::Memcpy(Bytes.GetData() + Offset, &Record, sizeof(uint32));
+        }
+        Bytes.AddUninitialized(TrailingBytes);
+        return Bytes;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFallibleIteratorTest, "ResultErrorHandling.FallibleIterator.Adaptors",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFallibleIteratorTest::RunTest(const FString& Parameters)
+{
+    const TArray<uint8> Bytes = EncodeRecords(10);
+
+    // Test map and filter are applied lazily, one record at a time
+    FRecordReader Reader(Bytes);
+    auto Squares = TryMap(TryFilter(Reader, [](uint32 Record) { return Record % 2 == 0; }), [](uint32 Record) { return Record * Record; });
+    TestEqual("First even square", Squares.TryNext().Unwrap().GetValue(), 4u);
+    TestEqual("Only the records needed should be decoded", Reader.Decoded, 2);
+    TestEqual("Second even square", Squares.TryNext().Unwrap().GetValue(), 16u);
+
+    // Test a fallible map ends the iteration with its error
+    FRecordReader Checked(Bytes);
+    auto Limited = TryMap(Checked, [](uint32 Record)
+    {
+        return Record < 3
+            ? TResult<uint32, FDecodeError>(ResultHelpers::Ok, Record)
+            : TResult<uint32, FDecodeError>(ResultHelpers::Err, FDecodeError{EDecodeErrorKind::InvalidLength, 8});
+    });
+    TestTrue("Accepted record should pass", Limited.TryNext().IsOk());
+    TestTrue("Accepted record should pass", Limited.TryNext().IsOk());
+    TestEqual("Rejected record should fail", Limited.TryNext().UnwrapErr(), FDecodeError{EDecodeErrorKind::InvalidLength, 8});
+
+    // Test a fallible predicate
+    FRecordReader Validated(Bytes);
+    auto NonZero = TryFilter(Validated, [](uint32 Record)
+    {
+        return Record != 4
+            ? TResult<bool, FDecodeError>(ResultHelpers::Ok, Record > 2)
+            : TResult<bool, FDecodeError>(ResultHelpers::Err, FDecodeError{EDecodeErrorKind::InvalidVarInt, 12});
+    });
+    TestEqual("Predicate should skip records", NonZero.TryNext().Unwrap().GetValue(), 3u);
+    TestTrue("Predicate error should surface", NonZero.TryNext().IsErr());
+
+    // Test chunks keep the partial chunk before a decode error
+    const TArray<uint8> Truncated = EncodeRecords(6, 2);
+    auto Chunks = TryChunks(FRecordReader(Truncated), 4);
+    TestEqual("First chunk should be full", Chunks.TryNext().Unwrap().GetValue().Num(), 4);
+    TestEqual("Partial chunk should precede the error", Chunks.TryNext().Unwrap().GetValue(), TArray<uint32>({5, 6}));
+    TResult<TOptional<TArray<uint32>>, FDecodeError> Failed = Chunks.TryNext();
+    TestTrue("Error should follow the partial chunk", Failed.IsErr());
+    TestEqual("Error should point at the partial record", Failed.UnwrapErr().Offset, 24);
+
+    // Test the end of the source
+    auto Whole = TryChunks(FRecordReader(Bytes), 5);
+    TestEqual("Full chunk", Whole.TryNext().Unwrap().GetValue().Num(), 5);
+    TestEqual("Full chunk", Whole.TryNext().Unwrap().GetValue().Num(), 5);
+    TestFalse("Exhausted source should end", Whole.TryNext().Unwrap().IsSet());
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFallibleIteratorRangeTest, "ResultErrorHandling.FallibleIterator.Range",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFallibleIteratorRangeTest::RunTest(const FString& Parameters)
+{
+    // Test a clean source runs to the end
+    const TArray<uint8> Bytes = EncodeRecords(5);
+    uint32 Sum = 0;
+    auto Records = TryIterate(FRecordReader(Bytes));
+    for (uint32 Record : Records)
+    {
+        Sum += Record;
+    }
+    TestEqual("Every record should be visited", Sum, 15u);
+    TestTrue("Clean source should succeed", Records.GetResult().IsOk());
+
+    // Test the loop stops at a decode error and stashes it
+    const TArray<uint8> Truncated = EncodeRecords(3, 1);
+    TArray<uint32> Visited;
+    auto Broken = TryIterate(FRecordReader(Truncated));
+    for (uint32 Record : Broken)
+    {
+        Visited.Add(Record);
+    }
+    TestEqual("Records before the error should be visited", Visited, TArray<uint32>({1, 2, 3}));
+    TestTrue("Error should be stashed", Broken.HasError());
+    TestEqual("Stashed error should be the decode error", Broken.GetResult().UnwrapErr().Offset, 12);
+
+    // Test chunked iteration over a result stream
+    TResultStream<int32, FString> Stream = TResultStream<int32, FString>::FromArray({1, 2, 3, 4, 5, 6, 7});
+    TArray<int32> ChunkSizes;
+    auto Chunked = TryIterate(TryChunks(Stream, 3));
+    for (const TArray<int32>& Chunk : Chunked)
+    {
+        ChunkSizes.Add(Chunk.Num());
+    }
+    TestEqual("Stream should be chunked", ChunkSizes, TArray<int32>({3, 3, 1}));
+    TestTrue("Stream should finish", Stream.IsFinished());
+
+    return true;
+}
@@ -0,0 +1,115 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "ResultType/JsonPullReader.h"
+
+namespace
+{
+    TArrayView<const uint8> JsonBytes(const ANSICHAR* Text)
+    {
+        return TArrayView<const uint8>(reinterpret_cast<const uint8*>(Text), FCStringAnsi::Strlen(Text));
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonPullReaderTokenTest, "ResultErrorHandling.JsonPullReader.Tokens",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FJsonPullReaderTokenTest::RunTest(const FString& Parameters)
+{
+    // Test token sequence
+    FJsonPullReader Reader(JsonBytes("{ \"name\": \"crate\", \"tags\": [1, -2.5e3, true, null] }"));
+    const EJsonTokenType Expected[] =
+    {
+        EJsonTokenType::ObjectStart, EJsonTokenType::Key, EJsonTokenType::String, EJsonTokenType::Key, EJsonTokenType::ArrayStart,
+        EJsonTokenType::Number, EJsonTokenType::Number, EJsonTokenType::True, EJsonTokenType::Null, EJsonTokenType::ArrayEnd,
+        EJsonTokenType::ObjectEnd, EJsonTokenType::EndOfInput
+    };
+    bool bAllMatch = true;
+    for (EJsonTokenType Type : Expected)
+    {
+        TResult<FJsonToken, FJsonError> Token = Reader.Next();
+        bAllMatch &= Token.IsOk() && Token.Unwrap().Type == Type;
+    }
+    TestTrue("Tokens should arrive in document order", bAllMatch);
+
+    // Test zero-copy strings
+    FJsonPullReader Strings(JsonBytes("[\"plain\", \"tab\\there \\u00e9\"]"));
+    Strings.Next();
+    TResult<FJsonToken, FJsonError> Plain = Strings.Next();
+    TestTrue("String text should view the source", Plain.Unwrap().Text.Equals(UTF8TEXTVIEW("plain")));
+    TestFalse("Plain string should have no escapes", Plain.Unwrap().bHasEscapes);
+    TestEqual("Escapes should decode", Strings.ReadString().Unwrap(), FString(TEXT("tab\there \u00e9")));
+
+    // Test errors carry line and column
+    FJsonPullReader Broken(JsonBytes("{\n  \"a\": 1,\n  \"b\" 2\n}"));
+    TResult<FJsonToken, FJsonError> Token = Broken.Next();
+    while (Token.IsOk())
+    {
+        Token = Broken.Next();
+    }
+    TestEqual("Missing colon should be located", Token.UnwrapErr(), FJsonError{EJsonErrorKind::UnexpectedCharacter, 18, 3, 7});
+    TestEqual("Errors should be sticky", Broken.Next().UnwrapErr(), Token.UnwrapErr());
+
+    TestEqual("Leading zero should be rejected", FJsonPullReader(JsonBytes("[01]")).SkipValue().UnwrapErr().Kind, EJsonErrorKind::UnexpectedCharacter);
+    TestEqual("Unterminated string should be rejected", FJsonPullReader(JsonBytes("\"abc")).SkipValue().UnwrapErr().Kind, EJsonErrorKind::UnexpectedEnd);
+    TestEqual("Invalid UTF-8 should be rejected", FJsonPullReader(JsonBytes("\"a\xC0\xAF\"")).SkipValue().UnwrapErr(), FJsonError{EJsonErrorKind::InvalidString, 2, 1, 3});
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonPullReaderTypedTest, "ResultErrorHandling.JsonPullReader.Typed",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FJsonPullReaderTypedTest::RunTest(const FString& Parameters)
+{
+    FJsonPullReader Reader(JsonBytes("{\"id\": 7, \"scale\": 0.5, \"visible\": false, \"extra\": {\"x\": [1, 2]}, \"sizes\": [3, 4, 5]}"));
+
+    int32 Id = 0;
+    double Scale = 0.0;
+    bool bVisible = true;
+    TArray<int32> Sizes;
+    TVoidResult<FJsonError> Result = Reader.ReadObject([&](const FJsonToken& Key) -> TVoidResult<FJsonError>
+    {
+        if (Key.Text.Equals(UTF8TEXTVIEW("id")))
+        {
+            return Reader.ReadNumber<int32>().Map([&Id](int32 Value) { Id = Value; return ResultHelpers::Unit; });
+        }
+        if (Key.Text.Equals(UTF8TEXTVIEW("scale")))
+        {
+            return Reader.ReadNumber<double>().Map([&Scale](double Value) { Scale = Value; return ResultHelpers::Unit; });
+        }
+        if (Key.Text.Equals(UTF8TEXTVIEW("visible")))
+        {
+            return Reader.ReadBool().Map([&bVisible](bool Value) { bVisible = Value; return ResultHelpers::Unit; });
+        }
+        if (Key.Text.Equals(UTF8TEXTVIEW("sizes")))
+        {
+            return Reader.ReadArray([&]()
+            {
+                return Reader.ReadNumber<int32>().Map([&Sizes](int32 Value) { Sizes.Add(Value); return ResultHelpers::Unit; });
+            });
+        }
+        return Reader.SkipValue();
+    });
+
+    TestTrue("Object should decode", Result.IsOk());
+    TestEqual("Integer member should decode", Id, 7);
+    TestEqual("Float member should decode", Scale, 0.5);
+    TestFalse("Bool member should decode", bVisible);
+    TestEqual("Array member should decode", Sizes.Num(), 3);
+
+    // Test typed mismatches
+    TestEqual("Fraction should not read as integer", FJsonPullReader(JsonBytes("1.5")).ReadNumber<int32>().UnwrapErr(), FJsonError{EJsonErrorKind::TypeMismatch, 1, 1, 2});
+    TestEqual("Out of range should be reported", FJsonPullReader(JsonBytes("300")).ReadNumber<uint8>().UnwrapErr().Kind, EJsonErrorKind::OutOfRange);
+    TestEqual("Float out of range should be reported", FJsonPullReader(JsonBytes("1e39")).ReadNumber<float>().UnwrapErr(), FJsonError{EJsonErrorKind::OutOfRange, 0, 1, 1});
+    TestEqual("String should not read as bool", FJsonPullReader(JsonBytes("\"yes\"")).ReadBool().UnwrapErr().Kind, EJsonErrorKind::TypeMismatch);
+
+    // Test skipping a pending key skips its member's value too
+    FJsonPullReader Members(JsonBytes("{\"extra\": {\"x\": [1, 2]}, \"id\": 3}"));
+    Members.Next();
+    TestTrue("Key and value should be skipped", Members.SkipValue().IsOk());
+    TResult<FJsonToken, FJsonError> NextKey = Members.Next();
+    TestTrue("Next token should be the following key", NextKey.IsOk() && NextKey.Unwrap().Type == EJsonTokenType::Key && NextKey.Unwrap().Text.Equals(UTF8TEXTVIEW("id")));
+    TestEqual("Following value should be readable", Members.ReadNumber<int32>().Unwrap(), 3);
+
+    return true;
+}
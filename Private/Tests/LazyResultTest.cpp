@@ -0,0 +1,64 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Async/Async.h"
+#include "ResultType/LazyResult.h"
+
+#include <atomic>
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLazyResultTest, "ResultErrorHandling.TLazyResult.Evaluate",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLazyResultTest::RunTest(const FString& Parameters)
+{
+    // Test nothing runs until the value is accessed
+    int32 Calls = 0;
+    TLazyResult<int32, FString> Table([&Calls]() { ++Calls; return TResult<int32, FString>(ResultHelpers::Ok, 42); });
+    TestFalse("Lazy value should start unevaluated", Table.IsEvaluated());
+    TestTrue("TryGet should not evaluate", Table.TryGet() == nullptr);
+    TestEqual("Initializer should not run on construction", Calls, 0);
+
+    // Test the outcome is cached
+    TestEqual("First access should evaluate", Table.Get().Unwrap(), 42);
+    TestEqual("Second access should reuse the value", Table.Get().Unwrap(), 42);
+    TestEqual("Initializer should run once", Calls, 1);
+    TestTrue("TryGet should return the cached value", Table.TryGet() == &Table.Get());
+
+    // Test errors are cached too
+    TLazyResult<int32, FString> Missing([&Calls]() { ++Calls; return TResult<int32, FString>(ResultHelpers::Err, FString(TEXT("Cache missing"))); });
+    TestTrue("Failed initializer should be an error", Missing.IsErr());
+    TestEqual("Error should be kept", Missing.Get().UnwrapErr(), FString(TEXT("Cache missing")));
+    TestEqual("Failed initializer should not be retried", Calls, 2);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLazyResultConcurrencyTest, "ResultErrorHandling.TLazyResult.Concurrency",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLazyResultConcurrencyTest::RunTest(const FString& Parameters)
+{
+    // Test concurrent first accessors wait for a single evaluation
+    std::atomic<int32> Calls{0};
+    TLazyResult<TArray<int32>, FString> Shared([&Calls]()
+    {
+        ++Calls;
+        FPlatformProcess::Sleep(0.01f);
+        return TResult<TArray<int32>, FString>(ResultHelpers::Ok, TArray<int32>({1, 2, 3}));
+    });
+
+    TArray<TFuture<int32>> Readers;
+    for (int32 Index = 0; Index < 8; ++Index)
+    {
+        Readers.Add(Async(EAsyncExecution::Thread, [&Shared]() { return Shared.Get().Unwrap().Num(); }));
+    }
+
+    bool bAllSeeValue = true;
+    for (TFuture<int32>& Reader : Readers)
+    {
+        bAllSeeValue &= Reader.Get() == 3;
+    }
+    TestTrue("Every reader should see the value", bAllSeeValue);
+    TestEqual("Initializer should run once across threads", Calls.load(), 1);
+
+    return true;
+}
@@ -0,0 +1,48 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/PlatformFileManager.h"
+#include "ResultType/MappedFile.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMappedFileTest, "ResultErrorHandling.MappedFile.Map",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMappedFileTest::RunTest(const FString& Parameters)
+{
+    TArray<uint8> Contents;
+    for (int32 Index = 0; Index < 10000; ++Index)
+    {
+        Contents.Add(static_cast<uint8>(Index * 7));
+    }
+
+    const FString Path = FPaths::CreateTempFilename(*FPaths::ProjectIntermediateDir(), TEXT("MappedFileTest"), TEXT(".bin"));
+    TestTrue("Test file should be written", FFileHelper::SaveArrayToFile(Contents, *Path));
+
+    // Mappings are scoped so the file can be deleted afterwards on every platform
+    {
+        // Test whole file mapping
+        TResult<FMappedRegion, FIoError> Whole = MapFile(Path, 0, MAX_int64, EMappedAccessHint::Sequential);
+        TestTrue("File should map", Whole.IsOk());
+        TestEqual("View should cover the file", Whole.Unwrap().Num(), Contents.Num());
+        TestEqual("View should expose the contents", Whole.Unwrap().GetView()[9999], Contents[9999]);
+
+        // Test windows at an unaligned offset
+        TResult<FMappedRegion, FIoError> Window = MapFile(Path, 5000, 100);
+        TestEqual("Window should have the requested size", Window.Unwrap().Num(), 100);
+        TestEqual("Window should start at the offset", Window.Unwrap().GetView()[0], Contents[5000]);
+        Window.Unwrap().Advise(EMappedAccessHint::WillNeed);
+
+        // Test copies share the mapping
+        FMappedRegion Copy = Whole.Unwrap();
+        TestTrue("Copies should view the same bytes", Copy.GetView().GetData() == Whole.Unwrap().GetView().GetData());
+
+        // Test errors
+        TestEqual("Missing file should report NotFound", MapFile(Path + TEXT(".missing")).UnwrapErr().Kind, EIoErrorKind::NotFound);
+        TestEqual("Offset past the end should report InvalidRange", MapFile(Path, 20000).UnwrapErr().Kind, EIoErrorKind::InvalidRange);
+        TestEqual("Empty range should map to an empty view", MapFile(Path, 10000).Unwrap().Num(), 0);
+    }
+
+    FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*Path);
+    return true;
+}
@@ -0,0 +1,79 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "ResultType/NumberParsing.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNumberParsingIntTest, "ResultErrorHandling.NumberParsing.Int",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNumberParsingIntTest::RunTest(const FString& Parameters)
+{
+    // Test valid integers
+    TestEqual("Positive integer should parse", ParseInt<int32>(TEXT("12345")).Unwrap(), 12345);
+    TestEqual("Negative integer should parse", ParseInt<int32>(TEXT("-42")).Unwrap(), -42);
+    TestEqual("Explicit plus should parse", ParseInt<int32>(TEXT("+7")).Unwrap(), 7);
+    TestEqual("Minimum int32 should parse", ParseInt<int32>(TEXT("-2147483648")).Unwrap(), MIN_int32);
+    TestEqual("Leading zeros should parse", ParseInt<uint64>(TEXT("000000000000000000000018446744073709551615")).Unwrap(), MAX_uint64);
+
+    // Test errors with offsets
+    TestEqual("Empty input should report Empty", ParseInt<int32>(TEXT("")).UnwrapErr(), FParseError{EParseErrorKind::Empty, 0});
+    TestEqual("Invalid character should report its offset", ParseInt<int32>(TEXT("12a4")).UnwrapErr(), FParseError{EParseErrorKind::InvalidCharacter, 2});
+    TestEqual("Sign alone should report UnexpectedEnd", ParseInt<int32>(TEXT("-")).UnwrapErr(), FParseError{EParseErrorKind::UnexpectedEnd, 1});
+    TestEqual("Negative unsigned should be rejected", ParseInt<uint32>(TEXT("-1")).UnwrapErr().Kind, EParseErrorKind::InvalidCharacter);
+    TestEqual("Out of range should report Overflow", ParseInt<int32>(TEXT("2147483648")).UnwrapErr().Kind, EParseErrorKind::Overflow);
+    TestEqual("uint64 overflow should report Overflow", ParseInt<uint64>(TEXT("18446744073709551616")).UnwrapErr().Kind, EParseErrorKind::Overflow);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNumberParsingFloatTest, "ResultErrorHandling.NumberParsing.Float",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNumberParsingFloatTest::RunTest(const FString& Parameters)
+{
+    // Test fast path values
+    TestEqual("Decimal should parse", ParseFloat(TEXT("3.25")).Unwrap(), 3.25);
+    TestEqual("Negative exponent should parse", ParseFloat(TEXT("-1.5e-3")).Unwrap(), -0.0015);
+    TestEqual("Leading dot should parse", ParseFloat(TEXT(".5")).Unwrap(), 0.5);
+    TestEqual("Float precision should parse", ParseFloat<float>(TEXT("0.1")).Unwrap(), 0.1f);
+
+    // Test slow path values
+    TestEqual("Long mantissa should parse", ParseFloat(TEXT("3.14159265358979323846264338327950288")).Unwrap(), 3.14159265358979323846);
+    TestEqual("Large exponent should parse", ParseFloat(TEXT("1e300")).Unwrap(), 1e300);
+
+    // Test errors
+    TestEqual("Missing exponent digits should report UnexpectedEnd", ParseFloat(TEXT("1e")).UnwrapErr(), FParseError{EParseErrorKind::UnexpectedEnd, 2});
+    TestEqual("Trailing garbage should report its offset", ParseFloat(TEXT("1.5x")).UnwrapErr(), FParseError{EParseErrorKind::InvalidCharacter, 3});
+    TestEqual("Double overflow should report Overflow", ParseFloat(TEXT("1e400")).UnwrapErr().Kind, EParseErrorKind::Overflow);
+    TestEqual("Float overflow should report Overflow", ParseFloat<float>(TEXT("1e39")).UnwrapErr(), FParseError{EParseErrorKind::Overflow, 0});
+    TestEqual("Negative float overflow should report Overflow", ParseFloat<float>(TEXT("-3.5e38")).UnwrapErr().Kind, EParseErrorKind::Overflow);
+    TestEqual("Largest float should parse", ParseFloat<float>(TEXT("3.4028234e38")).Unwrap(), TNumericLimits<float>::Max());
+    TestEqual("Shortest round-trip text of the largest float should parse", ParseFloat<float>(TEXT("3.4028235e38")).Unwrap(), TNumericLimits<float>::Max());
+    TestEqual("Printed largest float should round trip", ParseFloat<float>(FString::Printf(TEXT("%.9g"), TNumericLimits<float>::Max())).Unwrap(), TNumericLimits<float>::Max());
+    TestEqual("Value just below the rounding midpoint should parse", ParseFloat<float>(TEXT("3.40282356e38")).Unwrap(), TNumericLimits<float>::Max());
+    TestEqual("Value at the rounding midpoint should overflow", ParseFloat<float>(TEXT("3.4028235677973366e38")).UnwrapErr().Kind, EParseErrorKind::Overflow);
+
+    // Test an out of range value points at the start of its field
+    TArray<float> Column;
+    TestEqual("Column overflow should report the token start", ParseFloatColumn(TEXT("1.5,1e39"), TEXT(','), Column).UnwrapErr(), FParseError{EParseErrorKind::Overflow, 4});
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNumberParsingColumnTest, "ResultErrorHandling.NumberParsing.Column",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNumberParsingColumnTest::RunTest(const FString& Parameters)
+{
+    // Test column parsing with blanks and line breaks
+    TArray<int32> Values;
+    TestTrue("Column should parse", ParseIntColumn(TEXT("1, 2,3\r\n4\n"), TEXT(','), Values).IsOk());
+    TestEqual("Column should contain every value", Values.Num(), 4);
+    TestEqual("Column values should keep order", Values[3], 4);
+
+    // Test error offsets are relative to the whole text
+    TArray<double> Floats;
+    TVoidResult<FParseError> Failed = ParseFloatColumn(TEXT("1.0;2.x;3"), TEXT(';'), Floats);
+    TestEqual("Column error should point into the text", Failed.UnwrapErr(), FParseError{EParseErrorKind::InvalidCharacter, 6});
+
+    return true;
+}
@@ -0,0 +1,63 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/PlatformFileManager.h"
+#include "ResultType/OutcomeRecorder.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOutcomeRecorderTest, "ResultErrorHandling.OutcomeRecorder.RecordReplay",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FOutcomeRecorderTest::RunTest(const FString& Parameters)
+{
+    static const FOutcomeChannel ReadChannel(TEXT("Test.Read"));
+    static const FOutcomeChannel ClockChannel(TEXT("Test.Clock"));
+    const FString Path = FPaths::CreateTempFilename(*FPaths::ProjectIntermediateDir(), TEXT("OutcomeRecorderTest"), TEXT(".bin"));
+
+    // Test recording keeps the live outcomes
+    {
+        FOutcomeRecorder::FRecorderPtr Recorder = FOutcomeRecorder::StartRecording(Path).Unwrap();
+        for (int32 Index = 0; Index < 100; ++Index)
+        {
+            Recorder->Call(ReadChannel, [Index]()
+            {
+                return Index % 3 == 0
+                    ? TResult<FString, int32>(ResultHelpers::Err, Index)
+                    : TResult<FString, int32>(ResultHelpers::Ok, FString::FromInt(Index));
+            });
+        }
+        TestEqual("Live call should run while recording", Recorder->Call(ClockChannel, []() { return TResult<int64, FString>(ResultHelpers::Ok, 12345); }).Unwrap(), int64(12345));
+        TestTrue("Recording should flush", Recorder->Flush().IsOk());
+    }
+
+    // Test replay returns the recorded outcomes without running the calls
+    {
+        FOutcomeRecorder::FRecorderPtr Replayer = FOutcomeRecorder::StartReplay(Path).Unwrap();
+        TestEqual("Replay mode should be reported", Replayer->GetMode(), EOutcomeMode::Replay);
+
+        int32 LiveCalls = 0;
+        auto Live = [&LiveCalls]() { ++LiveCalls; return TResult<int64, FString>(ResultHelpers::Ok, 0); };
+        TestEqual("Channels should replay independently", Replayer->Call(ClockChannel, Live).Unwrap(), int64(12345));
+
+        auto LiveRead = [&LiveCalls]() { ++LiveCalls; return TResult<FString, int32>(ResultHelpers::Ok, FString()); };
+        TestEqual("First outcome should be the recorded error", Replayer->Call(ReadChannel, LiveRead).UnwrapErr(), 0);
+        TestEqual("Second outcome should be the recorded value", Replayer->Call(ReadChannel, LiveRead).Unwrap(), FString(TEXT("1")));
+        TestEqual("Replayed calls should not run", LiveCalls, 0);
+
+        // Test an exhausted channel falls back to the live call
+        Replayer->Call(ClockChannel, Live);
+        TestEqual("Exhausted channel should run the call", LiveCalls, 1);
+        TestEqual("Miss should be counted", Replayer->GetReplayMissCount(), 1);
+    }
+
+    // Test corrupt streams are rejected
+    TArray<uint8> Bytes;
+    FFileHelper::LoadFileToArray(Bytes, *Path);
+    Bytes.SetNum(Bytes.Num() - 1);
+    FFileHelper::SaveArrayToFile(Bytes, *Path);
+    TestEqual("Truncated stream should be reported", FOutcomeRecorder::StartReplay(Path).UnwrapErr().Kind, EIoErrorKind::InvalidFormat);
+    TestEqual("Missing stream should be reported", FOutcomeRecorder::StartReplay(Path + TEXT(".missing")).UnwrapErr().Kind, EIoErrorKind::NotFound);
+
+    FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*Path);
+    return true;
+}
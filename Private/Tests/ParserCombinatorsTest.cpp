@@ -0,0 +1,66 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "ResultType/ParserCombinators.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FParserCombinatorsPrimitiveTest, "ResultErrorHandling.ParserCombinators.Primitives",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FParserCombinatorsPrimitiveTest::RunTest(const FString& Parameters)
+{
+    using namespace ResultParsers;
+
+    // Test literal
+    auto LiteralResult = Literal(TEXT("key"))(TEXT("key=1"));
+    TestTrue("Literal should match prefix", LiteralResult.IsOk());
+    TestTrue("Literal should leave the rest", LiteralResult.Unwrap().Get<1>().Equals(TEXT("=1")));
+    TestEqual("Literal mismatch should report offset", Literal(TEXT("key"))(TEXT("kex")).UnwrapErr(), FParseError{EParseErrorKind::InvalidCharacter, 2});
+    TestEqual("Short input should report UnexpectedEnd", Literal(TEXT("key"))(TEXT("ke")).UnwrapErr(), FParseError{EParseErrorKind::UnexpectedEnd, 2});
+
+    // Test digit and predicate
+    TestEqual("Digit should yield its value", Digit()(TEXT("7x")).Unwrap().Get<0>(), 7);
+    TestEqual("Non digit should fail at zero", Digit()(TEXT("x")).UnwrapErr(), FParseError{EParseErrorKind::InvalidCharacter, 0});
+    TestEqual("CharIf should yield the character", CharIf([](TCHAR Char) { return Char == TEXT('_'); })(TEXT("_a")).Unwrap().Get<0>(), TCHAR(TEXT('_')));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FParserCombinatorsCompositionTest, "ResultErrorHandling.ParserCombinators.Composition",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FParserCombinatorsCompositionTest::RunTest(const FString& Parameters)
+{
+    using namespace ResultParsers;
+
+    auto Number = ManyFold(Digit(), 0, [](int32 Value, int32 Digit) { return Value * 10 + Digit; }, 1);
+    auto Name = Many(CharIf([](TCHAR Char) { return FChar::IsAlpha(Char); }), 1);
+    auto Assignment = Sequence(Name, Literal(TEXT("=")), Number);
+
+    // Test sequence
+    auto Parsed = ParseAll(Assignment, TEXT("width=640"));
+    TestTrue("Assignment should parse", Parsed.IsOk());
+    TestEqual("Number should fold digits", Parsed.Unwrap().Get<2>(), 640);
+    TestTrue("Name should be the matched span", Parsed.Unwrap().Get<0>().Equals(TEXT("width")));
+
+    // Test error offsets through composition
+    TestEqual("Missing value should report absolute offset", ParseAll(Assignment, TEXT("width=")).UnwrapErr(), FParseError{EParseErrorKind::UnexpectedEnd, 6});
+    TestEqual("Bad separator should report absolute offset", ParseAll(Assignment, TEXT("width:1")).UnwrapErr(), FParseError{EParseErrorKind::InvalidCharacter, 5});
+    TestEqual("Trailing input should be rejected", ParseAll(Assignment, TEXT("width=1;")).UnwrapErr(), FParseError{EParseErrorKind::InvalidCharacter, 7});
+
+    // Test choice and map
+    auto Boolean = Choice(Map(Literal(TEXT("true")), [](FStringView) { return true; }), Map(Literal(TEXT("false")), [](FStringView) { return false; }));
+    TestTrue("Choice should take the first match", ParseAll(Boolean, TEXT("true")).Unwrap());
+    TestFalse("Choice should try later alternatives", ParseAll(Boolean, TEXT("false")).Unwrap());
+    TestEqual("Choice should report the furthest error", ParseAll(Boolean, TEXT("fals")).UnwrapErr(), FParseError{EParseErrorKind::UnexpectedEnd, 4});
+
+    // Test map with a function returning a reference
+    const TArray<FString> Keywords = { TEXT("zero"), TEXT("one") };
+    auto Keyword = Map(Digit(), [&Keywords](int32 Index) -> const FString& { return Keywords[Index]; });
+    TestEqual("Map should copy a referenced value", ParseAll(Keyword, TEXT("1")).Unwrap(), FString(TEXT("one")));
+
+    // Test optional
+    auto Signed = Sequence(Optional(Literal(TEXT("-"))), Number);
+    TestFalse("Optional should be unset when absent", ParseAll(Signed, TEXT("5")).Unwrap().Get<0>().IsSet());
+    TestTrue("Optional should be set when present", ParseAll(Signed, TEXT("-5")).Unwrap().Get<0>().IsSet());
+
+    return true;
+}
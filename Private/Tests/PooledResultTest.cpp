@@ -0,0 +1,106 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Async/Async.h"
+#include "ResultType/PooledResult.h"
+
+#include <atomic>
+
+namespace
+{
+    struct FDecoderState
+    {
+        TArray<uint8> Scratch;
+        int32 Uses = 0;
+    };
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPooledResultTest, "ResultErrorHandling.TResultPool.Acquire",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPooledResultTest::RunTest(const FString& Parameters)
+{
+    int32 Constructed = 0;
+    TResultPool<FDecoderState> Pool(2, [&Constructed]()
+    {
+        ++Constructed;
+        FDecoderState State;
+        State.Scratch.SetNum(1024);
+        return State;
+    });
+
+    {
+        // Test acquisition until the pool is exhausted
+        TPooledRef<FDecoderState> First = TryAcquire(Pool).MoveUnwrap();
+        TPooledRef<FDecoderState> Second = TryAcquire(Pool).MoveUnwrap();
+        TestTrue("Handle should be valid", First.IsValid());
+        TestEqual("Factory should build the object", First->Scratch.Num(), 1024);
+        TestEqual("Objects should be in use", Pool.GetNumInUse(), 2);
+
+        TResult<TPooledRef<FDecoderState>, FPoolError> Exhausted = TryAcquire(Pool);
+        TestTrue("Empty pool should fail", Exhausted.IsErr());
+        TestEqual("Error should carry the capacity", Exhausted.UnwrapErr().Capacity, 2);
+        TestEqual("Error should carry the objects in use", Exhausted.UnwrapErr().InUse, 2);
+
+        // Test dropping a handle returns the object for reuse
+        First->Uses = 7;
+        First.Reset();
+        TPooledRef<FDecoderState> Reused = TryAcquire(Pool).MoveUnwrap();
+        TestEqual("Returned object should be reused as-is", Reused->Uses, 7);
+        TestEqual("Reuse should not construct", Constructed, 2);
+
+        // Test moving a handle keeps a single owner
+        TPooledRef<FDecoderState> Moved = MoveTemp(Reused);
+        TestFalse("Moved-from handle should be empty", Reused.IsValid());
+        TestEqual("Moving should not release", Pool.GetNumInUse(), 2);
+    }
+
+    TestEqual("Destroyed handles should release", Pool.GetNumInUse(), 0);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPooledResultConcurrencyTest, "ResultErrorHandling.TResultPool.Concurrency",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPooledResultConcurrencyTest::RunTest(const FString& Parameters)
+{
+    struct FSharedCheck
+    {
+        std::atomic<int32> Owners{0};
+        FSharedCheck() = default;
+        FSharedCheck(FSharedCheck&&) {}
+        FSharedCheck& operator=(FSharedCheck&&) { return *this; }
+    };
+
+    // Test an object is never handed to two threads at once
+    TResultPool<FSharedCheck> Pool(3);
+    std::atomic<int32> Overlaps{0};
+    std::atomic<int32> Acquired{0};
+
+    TArray<TFuture<void>> Workers;
+    for (int32 Thread = 0; Thread < 6; ++Thread)
+    {
+        Workers.Add(Async(EAsyncExecution::Thread, [&Pool, &Overlaps, &Acquired]()
+        {
+            for (int32 Index = 0; Index < 20000; ++Index)
+            {
+                TResult<TPooledRef<FSharedCheck>, FPoolError> Handle = Pool.TryAcquire();
+                if (Handle.IsOk())
+                {
+                    TPooledRef<FSharedCheck> Object = Handle.MoveUnwrap();
+                    Overlaps += Object->Owners.fetch_add(1) != 0 ? 1 : 0;
+                    Object->Owners.fetch_sub(1);
+                    ++Acquired;
+                }
+            }
+        }));
+    }
+    for (TFuture<void>& Worker : Workers)
+    {
+        Worker.Wait();
+    }
+
+    TestEqual("No object should be shared", Overlaps.load(), 0);
+    TestTrue("Threads should acquire objects", Acquired.load() > 0);
+    TestEqual("Every object should be returned", Pool.GetNumInUse(), 0);
+    return true;
+}
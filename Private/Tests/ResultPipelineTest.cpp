@@ -0,0 +1,111 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "ResultType/ResultPipeline.h"
+
+namespace
+{
+    TArray<int32> MakeInputs(int32 Count)
+    {
+        TArray<int32> Inputs;
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            Inputs.Add(Index);
+        }
+        return Inputs;
+    }
+
+    /** Parses, rejects multiples of seven, then formats */
+    auto MakeTestPipeline(int32 Parallelism)
+    {
+        return MakeResultPipeline<int32, FString>()
+            .Stage([](const int32& Value) { return TResult<int32, FString>(ResultHelpers::Ok, Value * 2); }, Parallelism)
+            .Stage([](const int32& Value)
+            {
+                return Value % 7 == 0 && Value > 0
+                    ? TResult<int32, FString>(ResultHelpers::Err, FString(TEXT("Rejected ")) + FString::FromInt(Value))
+                    : TResult<int32, FString>(ResultHelpers::Ok, Value + 1);
+            }, Parallelism)
+            .Stage([](const int32& Value) { return TResult<FString, FString>(ResultHelpers::Ok, FString::FromInt(Value)); });
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FResultPipelineOrderTest, "ResultErrorHandling.TResultPipeline.Order",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FResultPipelineOrderTest::RunTest(const FString& Parameters)
+{
+    // Test ordered output with parallel stages and small queues
+    FPipelineOptions Options;
+    Options.QueueCapacity = 4;
+    TResult<TPipelineOutput<FString, FString>, TPipelineFailure<FString>> Ordered = MakeTestPipeline(4).Run(MakeInputs(200), Options);
+    TestTrue("Sink policy should complete", Ordered.IsOk());
+
+    const TPipelineOutput<FString, FString>& Output = Ordered.Unwrap();
+    TestEqual("Rejected inputs should be removed", Output.Values.Num(), 200 - 28);
+    TestEqual("First value should keep its place", Output.Values[0], FString(TEXT("1")));
+    TestEqual("Values should follow input order", Output.Values[7], FString(TEXT("17")));
+
+    // Test failures carry their input and stage
+    TestEqual("Every rejection should be sunk", Output.Failures.Num(), 28);
+    TestEqual("Failures should be sorted by input", Output.Failures[0].InputIndex, 7);
+    TestEqual("Failure should name its stage", Output.Failures[0].StageIndex, 1);
+    TestEqual("Failure should keep its error", Output.Failures[0].Error, FString(TEXT("Rejected 14")));
+
+    // Test unordered output contains the same values
+    Options.Order = EPipelineOrder::Unordered;
+    TArray<FString> Unordered = MakeTestPipeline(3).Run(MakeInputs(200), Options).Unwrap().Values;
+    TestEqual("Unordered output should not lose values", Unordered.Num(), Output.Values.Num());
+    TArray<FString> Expected = Output.Values;
+    Unordered.Sort();
+    Expected.Sort();
+    TestEqual("Unordered output should hold the same values", Unordered, Expected);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FResultPipelineAbortTest, "ResultErrorHandling.TResultPipeline.Abort",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FResultPipelineAbortTest::RunTest(const FString& Parameters)
+{
+    // Test the abort policy returns the first failure instead of partial output
+    FPipelineOptions Options;
+    Options.ErrorPolicy = EPipelineErrorPolicy::Abort;
+    Options.QueueCapacity = 2;
+    TResult<TPipelineOutput<FString, FString>, TPipelineFailure<FString>> Aborted = MakeTestPipeline(2).Run(MakeInputs(10000), Options);
+    TestTrue("Abort policy should fail", Aborted.IsErr());
+    TestEqual("Abort should report the failing stage", Aborted.UnwrapErr().StageIndex, 1);
+
+    // Test a pipeline without failures under the abort policy
+    TestEqual("Clean run should succeed", MakeTestPipeline(2).Run(MakeInputs(4), Options).Unwrap().Values.Num(), 4);
+
+    // Test an empty input closes every stage
+    TestEqual("Empty input should produce nothing", MakeTestPipeline(2).Run(TArray<int32>()).Unwrap().Values.Num(), 0);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FResultPipelineBackpressureTest, "ResultErrorHandling.TResultPipeline.Backpressure",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FResultPipelineBackpressureTest::RunTest(const FString& Parameters)
+{
+    // Test tiny queues keep every input and its order while producers wait or drain the next stage themselves
+    FPipelineOptions Options;
+    Options.QueueCapacity = 2;
+    TArray<FString> Values = MakeTestPipeline(8).Run(MakeInputs(5000), Options).Unwrap().Values;
+    TestEqual("Every accepted input should come out", Values.Num(), 5000 - 714);
+    TestEqual("Order should be kept", Values[1], FString(TEXT("3")));
+
+    // Test values are moved between stages rather than copied
+    TArray<TArray<int32>> Chunks;
+    Chunks.Add(TArray<int32>({1, 2, 3}));
+    const int32* ChunkData = Chunks[0].GetData();
+    TArray<TArray<int32>> Moved = MakeResultPipeline<TArray<int32>, FString>()
+        .Stage([](TArray<int32>&& Chunk) { return TResult<TArray<int32>, FString>(ResultHelpers::Ok, MoveTemp(Chunk)); })
+        .Stage([](TArray<int32>&& Chunk) { return TResult<TArray<int32>, FString>(ResultHelpers::Ok, MoveTemp(Chunk)); })
+        .Run(MoveTemp(Chunks)).MoveUnwrap().Values;
+    TestTrue("Output should own the input allocation", Moved[0].GetData() == ChunkData);
+
+    return true;
+}
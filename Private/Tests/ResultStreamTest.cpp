@@ -0,0 +1,87 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "ResultType/ResultStream.h"
+
+namespace
+{
+    /** Counts from 1 to Limit and fails with FailAt if it is reached first */
+    TResultStream<int32, FString> CountTo(int32 Limit, int32 FailAt = MAX_int32)
+    {
+        return TResultStream<int32, FString>([Current = 0, Limit, FailAt]() mutable -> TOptional<TResult<int32, FString>>
+        {
+            if (++Current > Limit)
+            {
+                return TOptional<TResult<int32, FString>>();
+            }
+            if (Current == FailAt)
+            {
+                return TResult<int32, FString>(ResultHelpers::Err, FString(TEXT("Corrupt chunk")));
+            }
+            return TResult<int32, FString>(ResultHelpers::Ok, Current);
+        });
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FResultStreamAdaptorTest, "ResultErrorHandling.TResultStream.Adaptors",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FResultStreamAdaptorTest::RunTest(const FString& Parameters)
+{
+    // Test map and filter
+    TResult<TArray<int32>, FString> Squares = CountTo(6)
+        .Filter([](int32 Value) { return Value % 2 == 0; })
+        .Map([](int32 Value) { return Value * Value; })
+        .Collect();
+    TestEqual("Filtered squares should be collected", Squares.Unwrap(), TArray<int32>({4, 16, 36}));
+
+    // Test fallible transform
+    TResult<TArray<int32>, FString> Checked = CountTo(5)
+        .AndThen([](int32 Value)
+        {
+            return Value < 4 ? TResult<int32, FString>(ResultHelpers::Ok, Value) : TResult<int32, FString>(ResultHelpers::Err, FString(TEXT("Too large")));
+        })
+        .Collect();
+    TestEqual("AndThen error should end the stream", Checked.UnwrapErr(), FString(TEXT("Too large")));
+
+    // Test batching keeps the partial batch before an error
+    TResultStream<TArray<int32>, FString> Batches = CountTo(10, 6).Batch(4);
+    TestEqual("First batch should be full", Batches.Next()->Unwrap().Num(), 4);
+    TestEqual("Partial batch should precede the error", Batches.Next()->Unwrap().Num(), 1);
+    TestTrue("Error should follow the partial batch", Batches.Next()->IsErr());
+    TestFalse("Stream should end after the error", Batches.Next().IsSet());
+    TestTrue("Terminal error should be kept", Batches.GetTerminalError().IsSet());
+
+    // Test items are moved through the adaptors rather than copied
+    TArray<TArray<int32>> Chunks;
+    Chunks.Add(TArray<int32>({1, 2, 3}));
+    const int32* ChunkData = Chunks[0].GetData();
+    TResult<TArray<TArray<int32>>, FString> Moved = TResultStream<TArray<int32>, FString>::FromArray(MoveTemp(Chunks))
+        .Map([](TArray<int32>&& Chunk) { return MoveTemp(Chunk); })
+        .Collect();
+    TestTrue("Collected chunk should own the original allocation", Moved.Unwrap()[0].GetData() == ChunkData);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FResultStreamBufferedTest, "ResultErrorHandling.TResultStream.Buffered",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FResultStreamBufferedTest::RunTest(const FString& Parameters)
+{
+    // Test items arrive in order through the bounded buffer
+    int32 Sum = 0;
+    TVoidResult<FString> Result = CountTo(1000).Buffered(8).ForEach([&Sum](int32 Value) { Sum += Value; });
+    TestTrue("Buffered stream should complete", Result.IsOk());
+    TestEqual("Buffered stream should deliver every item", Sum, 500500);
+
+    // Test errors cross the producer thread
+    TestEqual("Buffered error should reach the consumer", CountTo(100, 50).Buffered(4).Collect().UnwrapErr(), FString(TEXT("Corrupt chunk")));
+
+    // Test dropping a stream with a blocked producer, the destructor must not hang
+    {
+        TResultStream<int32, FString> Early = CountTo(MAX_int32 - 1).Buffered(2);
+        TestEqual("First buffered item should arrive", Early.Next()->Unwrap(), 1);
+    }
+
+    return true;
+}
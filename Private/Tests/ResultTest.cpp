@@ -345,3 +345,162 @@ bool FTResultHelperFunctionsTest::RunTest(const FString& Parameters)
 
     return true;
 }
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTResultRelocationTest, "ResultErrorHandling.TResult.Relocation",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FTResultRelocationTest::RunTest(const FString& Parameters)
+{
+    // Test traits follow the payloads
+    TestTrue("Trivial payloads should be bitwise constructible", TIsBitwiseConstructible<TResult<int32, float>, TResult<int32, float>>::Value);
+    TestTrue("Void results should be bitwise constructible", TIsBitwiseConstructible<TVoidResult<int32>, TVoidResult<int32>>::Value);
+    TestTrue("Reference results should be bitwise constructible", TIsBitwiseConstructible<TResult<int32&, int32>, TResult<int32&, int32>>::Value);
+    TestFalse("Owning payloads should not be bitwise constructible", TIsBitwiseConstructible<TResult<int32, FString>, TResult<int32, FString>>::Value);
+
+    // Test the move constructor hands over the payload instead of copying it
+    TArray<int32> Values = {1, 2, 3};
+    TResult<TArray<int32>, FString> Source(ResultHelpers::Ok, Values);
+    const int32* Data = Source.Unwrap().GetData();
+    TResult<TArray<int32>, FString> Moved(MoveTemp(Source));
+    TestTrue("Moved payload should keep its allocation", Moved.Unwrap().GetData() == Data);
+
+    // Test bitwise relocated results keep their values across growth and insertion
+    TestTrue("Integer payloads should be bitwise constructible", TIsBitwiseConstructible<TResult<int32, int32>, TResult<int32, int32>>::Value);
+    TArray<TResult<int32, int32>> Codes;
+    for (int32 Index = 0; Index < 100; ++Index)
+    {
+        Codes.Add(Index % 3 == 0 ? TResult<int32, int32>(ResultHelpers::Err, -Index) : TResult<int32, int32>(ResultHelpers::Ok, Index));
+    }
+    Codes.Insert(TResult<int32, int32>(ResultHelpers::Err, -1000), 0);
+    Codes.RemoveAt(50);
+    TestEqual("Inserted error should be first", Codes[0].UnwrapErr(), -1000);
+    TestEqual("Ok value should survive relocation", Codes[2].Unwrap(), 1);
+    TestEqual("Error should survive relocation", Codes[99].UnwrapErr(), -99);
+    TestEqual("Value after the removed slot should shift down", Codes[50].Unwrap(), 50);
+
+    // Test reference results keep pointing at their targets after relocation
+    int32 Targets[3] = {10, 20, 30};
+    TArray<TResult<int32&, int32>> Refs;
+    for (int32& Target : Targets)
+    {
+        Refs.Add(TResult<int32&, int32>(ResultHelpers::Ok, Target));
+    }
+    Refs.Insert(TResult<int32&, int32>(ResultHelpers::Err, 7), 0);
+    Refs.RemoveAt(1);
+    TestTrue("Reference should still alias its target", &Refs[1].Unwrap() == &Targets[1]);
+    TestEqual("Error should survive relocation", Refs[0].UnwrapErr(), 7);
+
+    // Test owning payloads are not bitwise copy-constructible and their values survive TArray's relocation
+    TestFalse("Owning payloads should not be bitwise constructible", TIsBitwiseConstructible<TResult<FString, FString>, TResult<FString, FString>>::Value);
+    TArray<TResult<FString, FString>> Results;
+    for (int32 Index = 0; Index < 100; ++Index)
+    {
+        Results.Add(TResult<FString, FString>(ResultHelpers::Ok, FString::FromInt(Index)));
+    }
+    Results.Insert(TResult<FString, FString>(ResultHelpers::Err, FString(TEXT("Front"))), 0);
+    Results.RemoveAt(50);
+    TestEqual("Inserted error should be first", Results[0].UnwrapErr(), FString(TEXT("Front")));
+    TestEqual("Values should survive relocation", Results[99].Unwrap(), FString(TEXT("99")));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTResultSelectTest, "ResultErrorHandling.TResult.Select",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FTResultSelectTest::RunTest(const FString& Parameters)
+{
+    // Test UnwrapOrSelect matches UnwrapOr
+    TResult<int32, int32> OkInt(ResultHelpers::Ok, -5);
+    TResult<int32, int32> ErrInt(ResultHelpers::Err, 3);
+    TestEqual("Ok value should be selected", OkInt.UnwrapOrSelect(9), -5);
+    TestEqual("Default should be selected on Err", ErrInt.UnwrapOrSelect(9), 9);
+
+    TResult<float, uint8> OkFloat(ResultHelpers::Ok, 2.5f);
+    TResult<float, uint8> ErrFloat(ResultHelpers::Err, uint8(1));
+    TestEqual("Float Ok value should be selected", OkFloat.UnwrapOrSelect(-1.0f), 2.5f);
+    TestEqual("Float default should be selected on Err", ErrFloat.UnwrapOrSelect(-1.0f), -1.0f);
+    TestEqual("Small integers should be selected", TResult<uint8, int32>(ResultHelpers::Ok, uint8(200)).UnwrapOrSelect(uint8(7)), uint8(200));
+
+    // Test MapSelect keeps the variant and the error
+    TResult<double, int32> Mapped = OkInt.MapSelect([](int32 Value) { return Value * 0.5; });
+    TestTrue("Mapped Ok should stay Ok", Mapped.IsOk());
+    TestEqual("Mapped value should be transformed", Mapped.Unwrap(), -2.5);
+    TResult<double, int32> MappedErr = ErrInt.MapSelect([](int32 Value) { return Value * 0.5; });
+    TestTrue("Mapped Err should stay Err", MappedErr.IsErr());
+    TestEqual("Mapped error should be kept", MappedErr.UnwrapErr(), 3);
+
+    // Test Func is called with T{} for an Err result, so a division by the value must guard against zero
+    int32 Divisor = -1;
+    auto Reciprocal = [&Divisor](int32 Value)
+    {
+        Divisor = Value;
+        return Value != 0 ? 1000 / Value : 0;
+    };
+    TResult<int32, int32> Quotient = ErrInt.MapSelect(Reciprocal);
+    TestEqual("Func should see the zero value of an Err result", Divisor, 0);
+    TestEqual("Guarded quotient should keep the error", Quotient.UnwrapErr(), 3);
+
+    // Test a chained select still sees T{} rather than what the previous Func returned for the Err result
+    Quotient.MapSelect([](int32 Value) { return Value + 1; }).MapSelect(Reciprocal);
+    TestEqual("Chained Func should see the zero value", Divisor, 0);
+    TestEqual("Ok result should be divided", OkInt.MapSelect(Reciprocal).Unwrap(), -200);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTResultSelectPerfTest, "ResultErrorHandling.TResult.SelectPerf",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FTResultSelectPerfTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 NumSamples = 1 << 20;
+    constexpr int32 NumPasses = 8;
+
+    // Test branchy and select-based extraction at several error rates, results must match and timings are reported
+    for (const int32 ErrorPercent : {0, 10, 50, 90})
+    {
+        TArray<TResult<float, uint8>> Samples;
+        Samples.Reserve(NumSamples);
+        uint32 Seed = 12345;
+        for (int32 Index = 0; Index < NumSamples; ++Index)
+        {
+            Seed = Seed * 1664525u + 1013904223u;
+            if (static_cast<int32>((Seed >> 8) % 100) < ErrorPercent)
+            {
+                Samples.Add(TResult<float, uint8>(ResultHelpers::Err, uint8(1)));
+            }
+            else
+            {
+                Samples.Add(TResult<float, uint8>(ResultHelpers::Ok, static_cast<float>(Index % 1000)));
+            }
+        }
+
+        double BranchSum = 0.0;
+        const double BranchStart = FPlatformTime::Seconds();
+        for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+        {
+            for (const TResult<float, uint8>& Sample : Samples)
+            {
+                BranchSum += Sample.UnwrapOr(0.0f);
+            }
+        }
+        const double BranchSeconds = FPlatformTime::Seconds() - BranchStart;
+
+        double SelectSum = 0.0;
+        const double SelectStart = FPlatformTime::Seconds();
+        for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+        {
+            for (const TResult<float, uint8>& Sample : Samples)
+            {
+                SelectSum += Sample.UnwrapOrSelect(0.0f);
+            }
+        }
+        const double SelectSeconds = FPlatformTime::Seconds() - SelectStart;
+
+        TestEqual("Select should produce the same values", SelectSum, BranchSum);
+        AddInfo(FString::Printf(TEXT("%d%% errors: UnwrapOr %.2f ms, UnwrapOrSelect %.2f ms"), ErrorPercent, BranchSeconds * 1000.0, SelectSeconds * 1000.0));
+    }
+
+    return true;
+}
@@ -0,0 +1,62 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "ResultType/TextEncoding.h"
+
+namespace
+{
+    TArrayView<const uint8> Utf8Bytes(const ANSICHAR* Text)
+    {
+        return TArrayView<const uint8>(reinterpret_cast<const uint8*>(Text), FCStringAnsi::Strlen(Text));
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTextEncodingUtf8Test, "ResultErrorHandling.TextEncoding.Utf8",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FTextEncodingUtf8Test::RunTest(const FString& Parameters)
+{
+    // Test valid input, long enough to take the vectorized ASCII path
+    TestTrue("ASCII should be valid", ValidateUtf8(Utf8Bytes("The quick brown fox jumps over the lazy dog")).IsOk());
+    TestTrue("Multi-byte sequences should be valid", ValidateUtf8(Utf8Bytes("caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80")).IsOk());
+
+    // Test errors point at the start of the malformed sequence
+    TestEqual("Stray continuation should be reported", ValidateUtf8(Utf8Bytes("abcdefghijklmnopq\x80")).UnwrapErr(), FEncodingError{EEncodingErrorKind::UnexpectedContinuation, 17});
+    TestEqual("Overlong encoding should be reported", ValidateUtf8(Utf8Bytes("a\xC0\xAF")).UnwrapErr(), FEncodingError{EEncodingErrorKind::Overlong, 1});
+    TestEqual("Encoded surrogate should be reported", ValidateUtf8(Utf8Bytes("\xED\xA0\x80")).UnwrapErr(), FEncodingError{EEncodingErrorKind::Surrogate, 0});
+    TestEqual("Code point above U+10FFFF should be reported", ValidateUtf8(Utf8Bytes("\xF4\x90\x80\x80")).UnwrapErr(), FEncodingError{EEncodingErrorKind::OutOfRange, 0});
+    TestEqual("Truncated sequence should be reported", ValidateUtf8(Utf8Bytes("ab\xE2\x82")).UnwrapErr(), FEncodingError{EEncodingErrorKind::Truncated, 2});
+    TestEqual("Overlong prefix at the end should not be a truncation", ValidateUtf8(Utf8Bytes("ab\xE0\x80")).UnwrapErr(), FEncodingError{EEncodingErrorKind::Overlong, 2});
+    TestEqual("Surrogate prefix at the end should not be a truncation", ValidateUtf8(Utf8Bytes("\xED\xA0")).UnwrapErr(), FEncodingError{EEncodingErrorKind::Surrogate, 0});
+    TestEqual("Out of range prefix at the end should not be a truncation", ValidateUtf8(Utf8Bytes("\xF4\x90\x80")).UnwrapErr(), FEncodingError{EEncodingErrorKind::OutOfRange, 0});
+    TestEqual("Bad byte at the end should not be a truncation", ValidateUtf8(Utf8Bytes("\xF0\x9F\x41")).UnwrapErr(), FEncodingError{EEncodingErrorKind::InvalidContinuation, 0});
+    TestEqual("Bad continuation should be reported", ValidateUtf8(Utf8Bytes("\xE2\x28\xA1")).UnwrapErr(), FEncodingError{EEncodingErrorKind::InvalidContinuation, 0});
+
+    // Test transcoding
+    TResult<FString, FEncodingError> Transcoded = Utf8ToTChar(Utf8Bytes("caf\xC3\xA9"));
+    TestEqual("Transcoded length should count characters", Transcoded.Unwrap().Len(), 4);
+    TestTrue("Transcoded text should match", Transcoded.Unwrap()[3] == static_cast<TCHAR>(0xE9));
+    TestTrue("Transcoding invalid input should be Err", Utf8ToTChar(Utf8Bytes("\xFF")).IsErr());
+    TestTrue("Transcoding empty input should be empty", Utf8ToTChar(TArrayView<const uint8>()).Unwrap().IsEmpty());
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTextEncodingUtf16Test, "ResultErrorHandling.TextEncoding.Utf16",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FTextEncodingUtf16Test::RunTest(const FString& Parameters)
+{
+    const UTF16CHAR Valid[] = { 'H', 'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l', 'd', 0xD83D, 0xDE00 };
+    TestTrue("Surrogate pair should be valid", ValidateUtf16(TArrayView<const UTF16CHAR>(Valid, UE_ARRAY_COUNT(Valid))).IsOk());
+
+    const UTF16CHAR LoneHigh[] = { 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 0xD83D, 'x' };
+    TestEqual("Lone high surrogate should be reported", ValidateUtf16(TArrayView<const UTF16CHAR>(LoneHigh, UE_ARRAY_COUNT(LoneHigh))).UnwrapErr(), FEncodingError{EEncodingErrorKind::UnpairedSurrogate, 9});
+
+    const UTF16CHAR LoneLow[] = { 0xDE00 };
+    TestTrue("Lone low surrogate should be reported", ValidateUtf16(TArrayView<const UTF16CHAR>(LoneLow, 1)).IsErr());
+
+    TResult<FString, FEncodingError> Transcoded = Utf16ToTChar(TArrayView<const UTF16CHAR>(Valid, UE_ARRAY_COUNT(Valid)));
+    TestTrue("Transcoding valid UTF-16 should be Ok", Transcoded.IsOk());
+
+    return true;
+}
@@ -0,0 +1,293 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UnrealTemplate.h"
+
+#include <type_traits>
+
+class FAnyError;
+
+namespace ResultHelpers
+{
+    template<typename TError, typename = void>
+    struct THasErrorMessage : std::false_type {};
+
+    template<typename TError>
+    struct THasErrorMessage<TError, std::void_t<decltype(DeclVal<const TError&>().GetErrorMessage())>> : std::true_type {};
+
+    template<typename TError, typename = void>
+    struct THasErrorCode : std::false_type {};
+
+    template<typename TError>
+    struct THasErrorCode<TError, std::void_t<decltype(DeclVal<const TError&>().GetErrorCode())>> : std::true_type {};
+
+    template<typename TError, typename = void>
+    struct THasErrorSource : std::false_type {};
+
+    template<typename TError>
+    struct THasErrorSource<TError, std::void_t<decltype(DeclVal<const TError&>().GetErrorSource())>> : std::true_type {};
+
+    // Unique per type and stable across module boundaries, unlike the address of a template static
+    template<typename TError>
+    const ANSICHAR* GetAnyErrorTypeName()
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        return __FUNCSIG__;
+#else
+        return __PRETTY_FUNCTION__;
+#endif
+    }
+}
+
+/**
+ * Describes how an error type is viewed through FAnyError
+ * By default looks for GetErrorMessage(), GetErrorCode() and GetErrorSource() members,
+ * falls back to enum values and string conversions. Specialize for types you cannot change.
+ */
+template<typename TError>
+struct TAnyErrorTraits
+{
+    static FString GetErrorMessage(const TError& Error)
+    {
+        if constexpr (ResultHelpers::THasErrorMessage<TError>::value)
+        {
+            return FString(Error.GetErrorMessage());
+        }
+        else if constexpr (std::is_enum_v<TError>)
+        {
+            return FString::Printf(TEXT("Error code %d"), static_cast<int32>(Error));
+        }
+        else if constexpr (std::is_arithmetic_v<TError>)
+        {
+            return LexToString(Error);
+        }
+        else if constexpr (std::is_constructible_v<FString, const TError&>)
+        {
+            return FString(Error);
+        }
+        else
+        {
+            return FString(TEXT("Unknown error"));
+        }
+    }
+
+    static int32 GetErrorCode(const TError& Error)
+    {
+        if constexpr (ResultHelpers::THasErrorCode<TError>::value)
+        {
+            return static_cast<int32>(Error.GetErrorCode());
+        }
+        else if constexpr (std::is_enum_v<TError> || std::is_integral_v<TError>)
+        {
+            return static_cast<int32>(Error);
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    static const FAnyError* GetErrorSource(const TError& Error)
+    {
+        if constexpr (ResultHelpers::THasErrorSource<TError>::value)
+        {
+            return Error.GetErrorSource();
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+};
+
+/**
+ * Type-erased error that can hold any copyable error type
+ * Errors that fit in the inline buffer are stored in place and never allocate,
+ * dispatch goes through a static per-type table instead of virtual inheritance
+ */
+class RESULTERRORHANDLINGTYPE_API FAnyError
+{
+public:
+
+    static constexpr SIZE_T InlineSize = 48;
+    static constexpr SIZE_T InlineAlignment = 16;
+
+    template<typename TError>
+    static constexpr bool FitsInline = sizeof(TError) <= InlineSize
+        && alignof(TError) <= InlineAlignment
+        && std::is_nothrow_move_constructible_v<TError>;
+
+    // Constructors
+    FAnyError() = default;
+
+    template<typename TError, typename = std::enable_if_t<!std::is_same_v<TDecay_T<TError>, FAnyError>>>
+    FAnyError(TError&& Error)
+    {
+        Emplace<TDecay_T<TError>>(Forward<TError>(Error));
+    }
+
+    FAnyError(const FAnyError& Other);
+    FAnyError(FAnyError&& Other) noexcept;
+    ~FAnyError();
+
+    FAnyError& operator=(const FAnyError& Other);
+    FAnyError& operator=(FAnyError&& Other) noexcept;
+
+    template<typename TError, typename... ArgTypes>
+    TError& Emplace(ArgTypes&&... Args)
+    {
+        static_assert(std::is_copy_constructible_v<TError>, "FAnyError requires copyable error types");
+
+        Reset();
+        TError* Object;
+        if constexpr (FitsInline<TError>)
+        {
+            Object = new(Storage.Inline) TError(Forward<ArgTypes>(Args)...);
+        }
+        else
+        {
+            Object = new TError(Forward<ArgTypes>(Args)...);
+            Storage.Heap = Object;
+        }
+        VTable = &TVTableFor<TError>::Value;
+        return *Object;
+    }
+
+    void Reset();
+
+    // Querying
+    bool IsSet() const { return VTable != nullptr; }
+    bool IsInline() const { return VTable != nullptr && VTable->bInline; }
+
+    FString GetErrorMessage() const;
+    int32 GetErrorCode() const;
+    const FAnyError* GetErrorSource() const;
+
+    // Downcasting
+    template<typename TError>
+    bool Is() const
+    {
+        return IsSameType(&TVTableFor<TError>::Value);
+    }
+
+    template<typename TError>
+    const TError* DowncastTo() const
+    {
+        return Is<TError>() ? static_cast<const TError*>(GetObject()) : nullptr;
+    }
+
+    template<typename TError>
+    TError* DowncastTo()
+    {
+        return Is<TError>() ? static_cast<TError*>(GetObject()) : nullptr;
+    }
+
+private:
+
+    struct FVTable
+    {
+        const ANSICHAR* (*GetTypeName)();
+        FString (*GetErrorMessage)(const void* Object);
+        int32 (*GetErrorCode)(const void* Object);
+        const FAnyError* (*GetErrorSource)(const void* Object);
+        void (*CopyConstruct)(FAnyError& Dest, const FAnyError& Source);
+        void (*MoveConstruct)(FAnyError& Dest, FAnyError& Source);
+        void (*Destroy)(FAnyError& Self);
+        bool bInline;
+    };
+
+    template<typename TError>
+    struct TVTableFor
+    {
+        using FTraits = TAnyErrorTraits<TError>;
+
+        static FString GetErrorMessage(const void* Object)
+        {
+            return FTraits::GetErrorMessage(*static_cast<const TError*>(Object));
+        }
+
+        static int32 GetErrorCode(const void* Object)
+        {
+            return FTraits::GetErrorCode(*static_cast<const TError*>(Object));
+        }
+
+        static const FAnyError* GetErrorSource(const void* Object)
+        {
+            return FTraits::GetErrorSource(*static_cast<const TError*>(Object));
+        }
+
+        static void CopyConstruct(FAnyError& Dest, const FAnyError& Source)
+        {
+            const TError& Object = *static_cast<const TError*>(Source.GetObject());
+            if constexpr (FitsInline<TError>)
+            {
+                new(Dest.Storage.Inline) TError(Object);
+            }
+            else
+            {
+                Dest.Storage.Heap = new TError(Object);
+            }
+        }
+
+        static void MoveConstruct(FAnyError& Dest, FAnyError& Source)
+        {
+            if constexpr (FitsInline<TError>)
+            {
+                TError& Object = *reinterpret_cast<TError*>(Source.Storage.Inline);
+                new(Dest.Storage.Inline) TError(MoveTemp(Object));
+                Object.~TError();
+            }
+            else
+            {
+                Dest.Storage.Heap = Source.Storage.Heap;
+                Source.Storage.Heap = nullptr;
+            }
+        }
+
+        static void Destroy(FAnyError& Self)
+        {
+            if constexpr (FitsInline<TError>)
+            {
+                reinterpret_cast<TError*>(Self.Storage.Inline)->~TError();
+            }
+            else
+            {
+                delete static_cast<TError*>(Self.Storage.Heap);
+            }
+        }
+
+        static constexpr FVTable Value =
+        {
+            &ResultHelpers::GetAnyErrorTypeName<TError>,
+            &GetErrorMessage,
+            &GetErrorCode,
+            &GetErrorSource,
+            &CopyConstruct,
+            &MoveConstruct,
+            &Destroy,
+            FitsInline<TError>
+        };
+    };
+
+    const void* GetObject() const
+    {
+        return VTable->bInline ? static_cast<const void*>(Storage.Inline) : Storage.Heap;
+    }
+
+    void* GetObject()
+    {
+        return VTable->bInline ? static_cast<void*>(Storage.Inline) : Storage.Heap;
+    }
+
+    bool IsSameType(const FVTable* Other) const;
+
+    union
+    {
+        alignas(InlineAlignment) uint8 Inline[InlineSize];
+        void* Heap;
+    } Storage;
+
+    const FVTable* VTable = nullptr;
+};
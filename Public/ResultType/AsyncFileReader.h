@@ -0,0 +1,108 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/ArrayView.h"
+#include "HAL/CriticalSection.h"
+#include "IO/IoDispatcher.h"
+#include "ResultType/IoError.h"
+#include "ResultType/Result.h"
+
+class IAsyncReadFileHandle;
+class IAsyncReadRequest;
+
+enum class EIoPriority : uint8
+{
+    Low,
+    Normal,
+    High,
+    Critical,
+
+    Count
+};
+
+struct FIoReadRequest
+{
+    int64 Offset = 0;
+
+    /** Bytes to read, a negative size reads to the end of the file */
+    int64 Size = -1;
+
+    EIoPriority Priority = EIoPriority::Normal;
+};
+
+using FIoReadResult = TResult<FIoBuffer, FIoError>;
+
+/**
+ * Asynchronous reader for a single file built on IAsyncReadFileHandle
+ * At most MaxInFlight reads are issued to the platform at once, the rest wait in per-priority FIFO queues
+ * and are dispatched highest priority first as earlier reads complete. Data is read straight into the
+ * returned FIoBuffer. Futures are completed on a task graph thread, so continuations may release the reader.
+ */
+class RESULTERRORHANDLINGTYPE_API FAsyncFileReader
+{
+public:
+
+    UE_NONCOPYABLE(FAsyncFileReader);
+
+    static TResult<TSharedPtr<FAsyncFileReader, ESPMode::ThreadSafe>, FIoError> Open(const FString& Path, int32 MaxInFlight = 8);
+
+    /** Cancels queued reads and waits for the issued ones */
+    ~FAsyncFileReader();
+
+    TFuture<FIoReadResult> Read(const FIoReadRequest& Request);
+
+    /** Submits several reads under a single lock, the futures are in request order */
+    TArray<TFuture<FIoReadResult>> ReadBatch(TArrayView<const FIoReadRequest> Requests);
+
+    /** Completes every queued read that has not been issued yet with a Cancelled error */
+    void CancelPending();
+
+    const FString& GetPath() const { return Path; }
+    int64 GetFileSize() const { return FileSize; }
+
+    int32 GetInFlightCount() const;
+    int32 GetPendingCount() const;
+
+private:
+
+    struct FReadOp;
+    using FReadOpPtr = TSharedPtr<FReadOp, ESPMode::ThreadSafe>;
+
+    struct FIssuedRead
+    {
+        IAsyncReadRequest* Request = nullptr;
+        FReadOpPtr Op;
+    };
+
+    FAsyncFileReader(const FString& InPath, int64 InFileSize, IAsyncReadFileHandle* InHandle, int32 InMaxInFlight);
+
+    /** Validates the request and either completes it immediately or returns the op to queue */
+    FReadOpPtr Prepare(const FIoReadRequest& Request, TFuture<FIoReadResult>& OutFuture) const;
+
+    /** Moves queued ops into flight while slots are free, must be called with the lock held */
+    void TakeDispatchable(TArray<FReadOpPtr>& OutOps);
+
+    void Dispatch(TArray<FReadOpPtr>& Ops);
+    void OnReadComplete(const FReadOpPtr& Op, bool bWasCancelled, IAsyncReadRequest* Request);
+
+    /** Fulfils an issued op's promise from a task rather than from the platform callback */
+    static void Complete(const FReadOpPtr& Op, FIoReadResult&& Result);
+
+    /** Deletes requests whose callbacks have finished, requests cannot delete themselves */
+    void RetireCompleted();
+
+    FString Path;
+    int64 FileSize = 0;
+    int32 MaxInFlight = 8;
+
+    IAsyncReadFileHandle* Handle = nullptr;
+
+    mutable FCriticalSection Lock;
+    TArray<FReadOpPtr> Pending[static_cast<int32>(EIoPriority::Count)];
+    TArray<FIssuedRead> Issued;
+    int32 InFlight = 0;
+    bool bShuttingDown = false;
+};
@@ -0,0 +1,136 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+#include "Templates/Tuple.h"
+#include "ResultType/Result.h"
+
+#include <type_traits>
+#include <utility>
+
+enum class EDecodeErrorKind : uint8
+{
+    OutOfBounds,
+    InvalidVarInt,
+    InvalidLength,
+};
+
+/** Decode failure, Offset is the cursor position where the failing read started */
+struct FDecodeError
+{
+    EDecodeErrorKind Kind = EDecodeErrorKind::OutOfBounds;
+    int32 Offset = 0;
+
+    FString GetErrorMessage() const;
+    int32 GetErrorCode() const { return static_cast<int32>(Kind); }
+
+    bool operator==(const FDecodeError& Other) const
+    {
+        return Kind == Other.Kind && Offset == Other.Offset;
+    }
+};
+
+/**
+ * Bounds-checked forward reader over a byte buffer
+ * Every read reports failure immediately and leaves the cursor where it was. Spans are views into the
+ * buffer, so it must outlive them. Values are read in native byte order.
+ */
+class RESULTERRORHANDLINGTYPE_API FBinaryCursor
+{
+public:
+
+    explicit FBinaryCursor(TArrayView<const uint8> InBytes)
+        : Bytes(InBytes)
+    {
+    }
+
+    int32 Tell() const { return Position; }
+    int32 Remaining() const { return Bytes.Num() - Position; }
+    bool IsAtEnd() const { return Position >= Bytes.Num(); }
+
+    template<typename T>
+    TResult<T, FDecodeError> Read()
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Read requires a trivially copyable type");
+
+        if (!CanRead(sizeof(T)))
+        {
+            return MakeError<T>(EDecodeErrorKind::OutOfBounds);
+        }
+
+        T Value;
+        FMemory::Memcpy(&Value, Bytes.GetData() + Position, sizeof(T));
+        Position += sizeof(T);
+        return TResult<T, FDecodeError>(ResultHelpers::Ok, Value);
+    }
+
+    /** Reads several values with a single bounds check */
+    template<typename... Ts>
+    TResult<TTuple<Ts...>, FDecodeError> ReadBatch()
+    {
+        static_assert((std::is_trivially_copyable_v<Ts> && ...), "ReadBatch requires trivially copyable types");
+
+        constexpr int64 BatchSize = (static_cast<int64>(sizeof(Ts)) + ...);
+        if (!CanRead(BatchSize))
+        {
+            return MakeError<TTuple<Ts...>>(EDecodeErrorKind::OutOfBounds);
+        }
+        return TResult<TTuple<Ts...>, FDecodeError>(ResultHelpers::Ok, ReadBatchUnchecked<Ts...>(std::index_sequence_for<Ts...>()));
+    }
+
+    /** Fills Out with consecutive values using a single bounds check and copy */
+    template<typename T>
+    TVoidResult<FDecodeError> ReadInto(TArrayView<T> Out)
+    {
+        static_assert(std::is_trivially_copyable_v<T> && !std::is_const_v<T>, "ReadInto requires a mutable trivially copyable type");
+
+        const int64 Size = static_cast<int64>(Out.Num()) * sizeof(T);
+        if (!CanRead(Size))
+        {
+            return MakeError<ResultHelpers::FUnit>(EDecodeErrorKind::OutOfBounds);
+        }
+
+        FMemory::Memcpy(Out.GetData(), Bytes.GetData() + Position, Size);
+        Position += static_cast<int32>(Size);
+        return TVoidResult<FDecodeError>(ResultHelpers::Ok, ResultHelpers::Unit);
+    }
+
+    TResult<TArrayView<const uint8>, FDecodeError> ReadSpan(int32 Num);
+
+    /** Reads a span whose length is stored as a preceding VarInt */
+    TResult<TArrayView<const uint8>, FDecodeError> ReadSizedSpan();
+
+    TVoidResult<FDecodeError> Skip(int32 Num);
+
+    /** Unsigned LEB128, at most ten bytes */
+    TResult<uint64, FDecodeError> ReadVarInt();
+
+    /** Zigzag encoded LEB128 */
+    TResult<int64, FDecodeError> ReadVarIntSigned();
+
+private:
+
+    FORCEINLINE bool CanRead(int64 Size) const
+    {
+        return Size >= 0 && Size <= Remaining();
+    }
+
+    template<typename T>
+    TResult<T, FDecodeError> MakeError(EDecodeErrorKind Kind) const
+    {
+        return TResult<T, FDecodeError>(ResultHelpers::Err, FDecodeError{Kind, Position});
+    }
+
+    template<typename... Ts, SIZE_T... Indices>
+    TTuple<Ts...> ReadBatchUnchecked(std::index_sequence<Indices...>)
+    {
+        TTuple<Ts...> Values;
+        ((FMemory::Memcpy(&Values.template Get<Indices>(), Bytes.GetData() + Position, sizeof(Ts)), Position += sizeof(Ts)), ...);
+        return Values;
+    }
+
+    TArrayView<const uint8> Bytes;
+    int32 Position = 0;
+};
@@ -0,0 +1,170 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "ResultType/Result.h"
+
+#include <atomic>
+#include <type_traits>
+
+class FEvent;
+class FResultBulkhead;
+
+enum class EBulkheadErrorKind : uint8
+{
+    /** Every permit was taken and the caller could not queue */
+    Saturated,
+    /** The caller queued but no permit was released within the wait limit */
+    TimedOut,
+};
+
+struct FBulkheadError
+{
+    EBulkheadErrorKind Kind = EBulkheadErrorKind::Saturated;
+    int32 MaxConcurrent = 0;
+    int32 Waiting = 0;
+
+    FString GetErrorMessage() const
+    {
+        return Kind == EBulkheadErrorKind::Saturated
+            ? FString::Printf(TEXT("Bulkhead saturated: %d running, %d waiting"), MaxConcurrent, Waiting)
+            : FString::Printf(TEXT("Bulkhead wait timed out: %d running, %d waiting"), MaxConcurrent, Waiting);
+    }
+
+    bool operator==(const FBulkheadError& Other) const
+    {
+        return Kind == Other.Kind && MaxConcurrent == Other.MaxConcurrent && Waiting == Other.Waiting;
+    }
+};
+
+struct FBulkheadOptions
+{
+    /** Operations allowed to run at once */
+    int32 MaxConcurrent = 4;
+
+    /** Callers allowed to queue for a permit, zero rejects as soon as every permit is taken */
+    int32 MaxWaiting = 0;
+
+    /** Longest a queued caller waits before giving up */
+    uint32 MaxWaitMs = 0;
+};
+
+struct FBulkheadMetrics
+{
+    int32 InFlight = 0;
+    int32 Waiting = 0;
+
+    /** Permits handed out, including those that had to wait */
+    uint64 Admitted = 0;
+    uint64 AdmittedAfterWait = 0;
+    uint64 Saturated = 0;
+    uint64 TimedOut = 0;
+
+    /** Time spent queued by callers that were eventually admitted */
+    double TotalWaitSeconds = 0.0;
+    double MaxWaitSeconds = 0.0;
+};
+
+/** Move-only permit, gives its slot back to the bulkhead when reset or destroyed */
+class RESULTERRORHANDLINGTYPE_API FBulkheadPermit
+{
+public:
+
+    FBulkheadPermit() = default;
+    FBulkheadPermit(FBulkheadPermit&& Other);
+    FBulkheadPermit& operator=(FBulkheadPermit&& Other);
+    FBulkheadPermit(const FBulkheadPermit&) = delete;
+    FBulkheadPermit& operator=(const FBulkheadPermit&) = delete;
+    ~FBulkheadPermit();
+
+    bool IsValid() const { return Bulkhead != nullptr; }
+
+    /** Releases the permit early */
+    void Reset();
+
+private:
+
+    friend class FResultBulkhead;
+
+    explicit FBulkheadPermit(FResultBulkhead* InBulkhead)
+        : Bulkhead(InBulkhead)
+    {
+    }
+
+    FResultBulkhead* Bulkhead = nullptr;
+};
+
+/**
+ * Caps how many operations of one kind run at once, so an overloaded subsystem cannot take every worker thread
+ * Permits come from an atomic counter while one is free. Past the limit, callers queue in FIFO order for up to
+ * MaxWaitMs, or fail with Saturated once MaxWaiting callers are already queued.
+ */
+class RESULTERRORHANDLINGTYPE_API FResultBulkhead
+{
+public:
+
+    UE_NONCOPYABLE(FResultBulkhead);
+
+    explicit FResultBulkhead(const FBulkheadOptions& InOptions);
+    ~FResultBulkhead();
+
+    /** Takes a permit only if one is free and nobody is queued ahead */
+    TResult<FBulkheadPermit, FBulkheadError> TryAcquire();
+
+    /** Takes a permit, queuing behind earlier callers for up to MaxWaitMs when none is free */
+    TResult<FBulkheadPermit, FBulkheadError> Acquire();
+
+    /** Runs the function under a permit, a rejection is converted to the function's error type */
+    template<typename F>
+    TDecay_T<TInvokeResult_T<F>> Execute(F&& Func)
+    {
+        using FResultType = TDecay_T<TInvokeResult_T<F>>;
+        using E = typename FResultType::ErrValueType;
+        static_assert(std::is_constructible_v<E, const FBulkheadError&>, "Execute needs an error type constructible from FBulkheadError, such as FAnyError");
+
+        TResult<FBulkheadPermit, FBulkheadError> Permit = Acquire();
+        if (Permit.IsErr())
+        {
+            return FResultType(ResultHelpers::Err, E(Permit.UnwrapErr()));
+        }
+
+        const FBulkheadPermit Held = Permit.MoveUnwrap();
+        return Func();
+    }
+
+    FBulkheadMetrics GetMetrics() const;
+    const FBulkheadOptions& GetOptions() const { return Options; }
+
+private:
+
+    friend class FBulkheadPermit;
+
+    struct FWaiter
+    {
+        FEvent* Event = nullptr;
+        bool bGranted = false;
+    };
+
+    bool TryTakePermit();
+    void GrantWaiters();
+    void Release();
+    FBulkheadError MakeError(EBulkheadErrorKind Kind) const;
+
+    const FBulkheadOptions Options;
+
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<int32> Available;
+    std::atomic<int32> NumWaiting{0};
+
+    /** Queued callers, oldest first */
+    FCriticalSection WaitLock;
+    TArray<FWaiter*> Waiters;
+
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> Admitted{0};
+    std::atomic<uint64> AdmittedAfterWait{0};
+    std::atomic<uint64> Saturated{0};
+    std::atomic<uint64> TimedOut{0};
+    std::atomic<uint64> TotalWaitCycles{0};
+    std::atomic<uint64> MaxWaitCycles{0};
+};
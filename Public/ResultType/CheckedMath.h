@@ -0,0 +1,214 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ResultType/Result.h"
+
+#include <type_traits>
+
+enum class EArithError : uint8
+{
+    Overflow,
+    NarrowingLoss,
+    SizeMismatch,
+};
+
+/** Error of a batch operation, Index is the first element that failed */
+struct FArithBatchError
+{
+    EArithError Error = EArithError::Overflow;
+    int32 Index = INDEX_NONE;
+
+    bool operator==(const FArithBatchError& Other) const
+    {
+        return Error == Other.Error && Index == Other.Index;
+    }
+};
+
+namespace ResultHelpers
+{
+    // Overflowing operations, return true when the exact result does not fit in T
+    template<typename T>
+    FORCEINLINE bool AddOverflows(T A, T B, T& Out)
+    {
+        static_assert(std::is_integral_v<T>, "Checked math requires integral types");
+#if defined(__clang__) || defined(__GNUC__)
+        return __builtin_add_overflow(A, B, &Out);
+#else
+        using FUnsigned = std::make_unsigned_t<T>;
+        Out = static_cast<T>(static_cast<FUnsigned>(A) + static_cast<FUnsigned>(B));
+        if constexpr (std::is_signed_v<T>)
+        {
+            // Overflow when both operands share a sign that the result does not
+            return ((A ^ Out) & (B ^ Out)) < 0;
+        }
+        else
+        {
+            return Out < A;
+        }
+#endif
+    }
+
+    template<typename T>
+    FORCEINLINE bool MulOverflows(T A, T B, T& Out)
+    {
+        static_assert(std::is_integral_v<T>, "Checked math requires integral types");
+#if defined(__clang__) || defined(__GNUC__)
+        return __builtin_mul_overflow(A, B, &Out);
+#else
+        if constexpr (sizeof(T) < sizeof(int64))
+        {
+            using FWide = std::conditional_t<std::is_signed_v<T>, int64, uint64>;
+            const FWide Wide = static_cast<FWide>(A) * static_cast<FWide>(B);
+            Out = static_cast<T>(Wide);
+            return Wide != static_cast<FWide>(Out);
+        }
+        else
+        {
+            using FUnsigned = std::make_unsigned_t<T>;
+            Out = static_cast<T>(static_cast<FUnsigned>(A) * static_cast<FUnsigned>(B));
+            if (A == 0 || B == 0)
+            {
+                return false;
+            }
+            if constexpr (std::is_signed_v<T>)
+            {
+                if ((A == -1 && B == TNumericLimits<T>::Min()) || (B == -1 && A == TNumericLimits<T>::Min()))
+                {
+                    return true;
+                }
+            }
+            return Out / B != A;
+        }
+#endif
+    }
+}
+
+// Checked scalar arithmetic
+template<typename T>
+TResult<T, EArithError> CheckedAdd(T A, T B)
+{
+    T Out;
+    if (ResultHelpers::AddOverflows(A, B, Out))
+    {
+        return TResult<T, EArithError>(ResultHelpers::Err, EArithError::Overflow);
+    }
+    return TResult<T, EArithError>(ResultHelpers::Ok, Out);
+}
+
+template<typename T>
+TResult<T, EArithError> CheckedMul(T A, T B)
+{
+    T Out;
+    if (ResultHelpers::MulOverflows(A, B, Out))
+    {
+        return TResult<T, EArithError>(ResultHelpers::Err, EArithError::Overflow);
+    }
+    return TResult<T, EArithError>(ResultHelpers::Ok, Out);
+}
+
+/** Converts between integral types, failing when the value is not representable in ToType */
+template<typename ToType, typename FromType>
+TResult<ToType, EArithError> CheckedNarrow(FromType Value)
+{
+    static_assert(std::is_integral_v<ToType> && std::is_integral_v<FromType>, "CheckedNarrow requires integral types");
+
+    const ToType Narrowed = static_cast<ToType>(Value);
+    const bool bSignFlipped = std::is_signed_v<ToType> != std::is_signed_v<FromType> && ((Narrowed < ToType{}) != (Value < FromType{}));
+    if (static_cast<FromType>(Narrowed) != Value || bSignFlipped)
+    {
+        return TResult<ToType, EArithError>(ResultHelpers::Err, EArithError::NarrowingLoss);
+    }
+    return TResult<ToType, EArithError>(ResultHelpers::Ok, Narrowed);
+}
+
+/**
+ * Batch variants
+ * The loop body is branch-free, overflow flags are OR-reduced so the compiler can vectorize it.
+ * The first failing index is only searched for when the reduced flag is set.
+ */
+namespace ResultHelpers
+{
+    template<typename T, typename OpType>
+    TVoidResult<FArithBatchError> CheckedBatch(TArrayView<const T> A, TArrayView<const T> B, TArrayView<T> Out, OpType Op)
+    {
+        if (A.Num() != B.Num() || A.Num() != Out.Num())
+        {
+            return TVoidResult<FArithBatchError>(Err, FArithBatchError{EArithError::SizeMismatch, INDEX_NONE});
+        }
+
+        const T* RESTRICT APtr = A.GetData();
+        const T* RESTRICT BPtr = B.GetData();
+        T* RESTRICT OutPtr = Out.GetData();
+        const int32 Num = A.Num();
+
+        bool bAnyOverflow = false;
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            bAnyOverflow |= Op(APtr[Index], BPtr[Index], OutPtr[Index]);
+        }
+
+        if (LIKELY(!bAnyOverflow))
+        {
+            return TVoidResult<FArithBatchError>(Ok, Unit);
+        }
+
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            T Scratch;
+            if (Op(APtr[Index], BPtr[Index], Scratch))
+            {
+                return TVoidResult<FArithBatchError>(Err, FArithBatchError{EArithError::Overflow, Index});
+            }
+        }
+        return TVoidResult<FArithBatchError>(Ok, Unit);
+    }
+}
+
+/** Out[i] = A[i] + B[i], Out must not overlap the inputs and is fully written even on failure */
+template<typename T>
+TVoidResult<FArithBatchError> CheckedAddBatch(TArrayView<const T> A, TArrayView<const T> B, TArrayView<T> Out)
+{
+    return ResultHelpers::CheckedBatch(A, B, Out, [](T X, T Y, T& R) { return ResultHelpers::AddOverflows(X, Y, R); });
+}
+
+/** Out[i] = A[i] * B[i], Out must not overlap the inputs and is fully written even on failure */
+template<typename T>
+TVoidResult<FArithBatchError> CheckedMulBatch(TArrayView<const T> A, TArrayView<const T> B, TArrayView<T> Out)
+{
+    return ResultHelpers::CheckedBatch(A, B, Out, [](T X, T Y, T& R) { return ResultHelpers::MulOverflows(X, Y, R); });
+}
+
+/** Out[i] = narrowed In[i], Out is fully written even on failure */
+template<typename ToType, typename FromType>
+TVoidResult<FArithBatchError> CheckedNarrowBatch(TArrayView<const FromType> In, TArrayView<ToType> Out)
+{
+    if (In.Num() != Out.Num())
+    {
+        return TVoidResult<FArithBatchError>(ResultHelpers::Err, FArithBatchError{EArithError::SizeMismatch, INDEX_NONE});
+    }
+
+    bool bAnyLoss = false;
+    for (int32 Index = 0; Index < In.Num(); ++Index)
+    {
+        const ToType Narrowed = static_cast<ToType>(In[Index]);
+        const bool bSignFlipped = std::is_signed_v<ToType> != std::is_signed_v<FromType> && ((Narrowed < ToType{}) != (In[Index] < FromType{}));
+        bAnyLoss |= (static_cast<FromType>(Narrowed) != In[Index]) | bSignFlipped;
+        Out[Index] = Narrowed;
+    }
+
+    if (LIKELY(!bAnyLoss))
+    {
+        return TVoidResult<FArithBatchError>(ResultHelpers::Ok, ResultHelpers::Unit);
+    }
+
+    for (int32 Index = 0; Index < In.Num(); ++Index)
+    {
+        if (CheckedNarrow<ToType>(In[Index]).IsErr())
+        {
+            return TVoidResult<FArithBatchError>(ResultHelpers::Err, FArithBatchError{EArithError::NarrowingLoss, Index});
+        }
+    }
+    return TVoidResult<FArithBatchError>(ResultHelpers::Ok, ResultHelpers::Unit);
+}
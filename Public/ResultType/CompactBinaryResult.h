@@ -0,0 +1,180 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IO/IoHash.h"
+#include "Misc/Optional.h"
+#include "Serialization/CompactBinary.h"
+#include "Serialization/CompactBinarySerialization.h"
+#include "Serialization/CompactBinaryWriter.h"
+#include "ResultType/AnyError.h"
+#include "ResultType/Result.h"
+
+#include <type_traits>
+
+/**
+ * Compact Binary layout of a TResult, an object with these fields:
+ *   "t" - one byte tag, ECbResultTag
+ *   "v" - Ok value, omitted for TVoidResult
+ *   "c" - Err code from TAnyErrorTraits, stable across changes to the error type and readable without knowing it
+ *   "e" - Err payload, omitted for enum and integer errors which are fully described by their code
+ * Field names and tag values are part of the stored format and must not change.
+ */
+enum class ECbResultTag : uint8
+{
+    Err = 0,
+    Ok = 1,
+};
+
+namespace ResultHelpers
+{
+    template<typename V, typename = void>
+    struct THasCbSave : std::false_type {};
+
+    template<typename V>
+    struct THasCbSave<V, std::void_t<decltype(DeclVal<FCbWriter&>() << DeclVal<const V&>())>> : std::true_type {};
+
+    template<typename V, typename = void>
+    struct THasCbLoad : std::false_type {};
+
+    template<typename V>
+    struct THasCbLoad<V, std::void_t<decltype(LoadFromCompactBinary(DeclVal<FCbFieldView>(), DeclVal<V&>()))>> : std::true_type {};
+
+    /** Errors whose code is the whole error */
+    template<typename E>
+    constexpr bool IsCbCodeOnlyError = std::is_enum_v<E> || std::is_integral_v<E>;
+}
+
+/**
+ * Read-only view of a stored TResult
+ * Fields are read in place from the buffer, so it must outlive the view. The tag, the error code and the
+ * payload views can be inspected without knowing the value or error types.
+ */
+class FCbResultView
+{
+public:
+
+    FCbResultView() = default;
+
+    explicit FCbResultView(FCbObjectView InObject)
+        : Object(InObject)
+    {
+    }
+
+    explicit FCbResultView(FCbFieldView Field)
+        : Object(Field.AsObjectView())
+    {
+    }
+
+    /** True if the tag field holds a known tag */
+    bool IsValid() const
+    {
+        FCbFieldView Tag = Object[UTF8TEXTVIEW("t")];
+        const uint8 Value = Tag.AsUInt8(MAX_uint8);
+        return !Tag.HasError() && (Value == static_cast<uint8>(ECbResultTag::Ok) || Value == static_cast<uint8>(ECbResultTag::Err));
+    }
+
+    bool IsOk() const { return Object[UTF8TEXTVIEW("t")].AsUInt8(MAX_uint8) == static_cast<uint8>(ECbResultTag::Ok); }
+    bool IsErr() const { return Object[UTF8TEXTVIEW("t")].AsUInt8(MAX_uint8) == static_cast<uint8>(ECbResultTag::Err); }
+
+    FCbFieldView GetValueView() const { return Object[UTF8TEXTVIEW("v")]; }
+    FCbFieldView GetErrorView() const { return Object[UTF8TEXTVIEW("e")]; }
+
+    /** Code of a stored error, zero for an Ok result */
+    int32 GetErrorCode() const { return Object[UTF8TEXTVIEW("c")].AsInt32(); }
+
+    /** Hash of the stored object, the same hash the cache computes for it */
+    FIoHash GetHash() const { return Object.GetHash(); }
+
+    FCbObjectView GetObjectView() const { return Object; }
+
+    /** Rebuilds the result, unset if the tag is unknown or the value or error does not load as the given types */
+    template<typename T, typename E>
+    TOptional<TResult<T, E>> Load() const
+    {
+        if (IsOk())
+        {
+            if constexpr (std::is_same_v<T, ResultHelpers::FUnit>)
+            {
+                return TResult<T, E>(ResultHelpers::Ok, ResultHelpers::Unit);
+            }
+            else
+            {
+                static_assert(ResultHelpers::THasCbLoad<T>::value, "TResult value type has no LoadFromCompactBinary overload");
+
+                T Value;
+                if (LoadFromCompactBinary(GetValueView(), Value))
+                {
+                    return TResult<T, E>(ResultHelpers::Ok, MoveTemp(Value));
+                }
+            }
+        }
+        else if (IsErr())
+        {
+            if constexpr (ResultHelpers::IsCbCodeOnlyError<E>)
+            {
+                FCbFieldView Code = Object[UTF8TEXTVIEW("c")];
+                const int32 Value = Code.AsInt32();
+                if (!Code.HasError())
+                {
+                    return TResult<T, E>(ResultHelpers::Err, static_cast<E>(Value));
+                }
+            }
+            else
+            {
+                static_assert(ResultHelpers::THasCbLoad<E>::value, "TResult error type has no LoadFromCompactBinary overload");
+
+                E Error;
+                if (LoadFromCompactBinary(GetErrorView(), Error))
+                {
+                    return TResult<T, E>(ResultHelpers::Err, MoveTemp(Error));
+                }
+            }
+        }
+        return TOptional<TResult<T, E>>();
+    }
+
+private:
+
+    FCbObjectView Object;
+};
+
+template<typename T, typename E>
+FCbWriter& operator<<(FCbWriter& Writer, const TResult<T, E>& Result)
+{
+    Writer.BeginObject();
+    if (Result.IsOk())
+    {
+        Writer.AddInteger(UTF8TEXTVIEW("t"), static_cast<uint8>(ECbResultTag::Ok));
+        if constexpr (!std::is_same_v<T, ResultHelpers::FUnit>)
+        {
+            static_assert(ResultHelpers::THasCbSave<T>::value, "TResult value type cannot be written to an FCbWriter");
+            Writer.SetName(UTF8TEXTVIEW("v")) << Result.Unwrap();
+        }
+    }
+    else
+    {
+        Writer.AddInteger(UTF8TEXTVIEW("t"), static_cast<uint8>(ECbResultTag::Err));
+        Writer.AddInteger(UTF8TEXTVIEW("c"), TAnyErrorTraits<E>::GetErrorCode(Result.UnwrapErr()));
+        if constexpr (!ResultHelpers::IsCbCodeOnlyError<E>)
+        {
+            static_assert(ResultHelpers::THasCbSave<E>::value, "TResult error type cannot be written to an FCbWriter");
+            Writer.SetName(UTF8TEXTVIEW("e")) << Result.UnwrapErr();
+        }
+    }
+    Writer.EndObject();
+    return Writer;
+}
+
+template<typename T, typename E>
+bool LoadFromCompactBinary(FCbFieldView Field, TResult<T, E>& OutResult)
+{
+    TOptional<TResult<T, E>> Loaded = FCbResultView(Field).Load<T, E>();
+    if (!Loaded.IsSet())
+    {
+        return false;
+    }
+    OutResult = MoveTemp(Loaded.GetValue());
+    return true;
+}
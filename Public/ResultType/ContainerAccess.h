@@ -0,0 +1,134 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ResultType/Result.h"
+
+enum class ELookupError : uint8
+{
+    OutOfRange,
+    NotFound,
+    Empty,
+};
+
+/**
+ * Checked container accessors
+ * Lookups return a TResult referencing the element in place, no element is copied
+ */
+
+// TArray
+template<typename T, typename Allocator>
+TResult<T&, ELookupError> TryGet(TArray<T, Allocator>& Array, int32 Index)
+{
+    if (!Array.IsValidIndex(Index))
+    {
+        return TResult<T&, ELookupError>(ResultHelpers::Err, ELookupError::OutOfRange);
+    }
+    return TResult<T&, ELookupError>(ResultHelpers::Ok, Array[Index]);
+}
+
+template<typename T, typename Allocator>
+TResult<const T&, ELookupError> TryGet(const TArray<T, Allocator>& Array, int32 Index)
+{
+    if (!Array.IsValidIndex(Index))
+    {
+        return TResult<const T&, ELookupError>(ResultHelpers::Err, ELookupError::OutOfRange);
+    }
+    return TResult<const T&, ELookupError>(ResultHelpers::Ok, Array[Index]);
+}
+
+/** Removes the last element and returns it by value since it no longer lives in the array */
+template<typename T, typename Allocator>
+TResult<T, ELookupError> TryPop(TArray<T, Allocator>& Array)
+{
+    if (Array.Num() == 0)
+    {
+        return TResult<T, ELookupError>(ResultHelpers::Err, ELookupError::Empty);
+    }
+    return TResult<T, ELookupError>(ResultHelpers::Ok, Array.Pop());
+}
+
+// TSparseArray
+template<typename T, typename Allocator>
+TResult<T&, ELookupError> TryGet(TSparseArray<T, Allocator>& Array, int32 Index)
+{
+    if (!Array.IsValidIndex(Index))
+    {
+        return TResult<T&, ELookupError>(ResultHelpers::Err, ELookupError::OutOfRange);
+    }
+    return TResult<T&, ELookupError>(ResultHelpers::Ok, Array[Index]);
+}
+
+template<typename T, typename Allocator>
+TResult<const T&, ELookupError> TryGet(const TSparseArray<T, Allocator>& Array, int32 Index)
+{
+    if (!Array.IsValidIndex(Index))
+    {
+        return TResult<const T&, ELookupError>(ResultHelpers::Err, ELookupError::OutOfRange);
+    }
+    return TResult<const T&, ELookupError>(ResultHelpers::Ok, Array[Index]);
+}
+
+// TMap
+template<typename K, typename V, typename SetAllocator, typename KeyFuncs>
+TResult<V&, ELookupError> TryFind(TMap<K, V, SetAllocator, KeyFuncs>& Map, typename TMap<K, V, SetAllocator, KeyFuncs>::KeyConstPointerType Key)
+{
+    if (V* Value = Map.Find(Key))
+    {
+        return TResult<V&, ELookupError>(ResultHelpers::Ok, *Value);
+    }
+    return TResult<V&, ELookupError>(ResultHelpers::Err, ELookupError::NotFound);
+}
+
+template<typename K, typename V, typename SetAllocator, typename KeyFuncs>
+TResult<const V&, ELookupError> TryFind(const TMap<K, V, SetAllocator, KeyFuncs>& Map, typename TMap<K, V, SetAllocator, KeyFuncs>::KeyConstPointerType Key)
+{
+    if (const V* Value = Map.Find(Key))
+    {
+        return TResult<const V&, ELookupError>(ResultHelpers::Ok, *Value);
+    }
+    return TResult<const V&, ELookupError>(ResultHelpers::Err, ELookupError::NotFound);
+}
+
+// TSet
+template<typename T, typename KeyFuncs, typename Allocator>
+TResult<T&, ELookupError> TryFind(TSet<T, KeyFuncs, Allocator>& Set, const typename KeyFuncs::KeyInitType Key)
+{
+    if (T* Element = Set.Find(Key))
+    {
+        return TResult<T&, ELookupError>(ResultHelpers::Ok, *Element);
+    }
+    return TResult<T&, ELookupError>(ResultHelpers::Err, ELookupError::NotFound);
+}
+
+template<typename T, typename KeyFuncs, typename Allocator>
+TResult<const T&, ELookupError> TryFind(const TSet<T, KeyFuncs, Allocator>& Set, const typename KeyFuncs::KeyInitType Key)
+{
+    if (const T* Element = Set.Find(Key))
+    {
+        return TResult<const T&, ELookupError>(ResultHelpers::Ok, *Element);
+    }
+    return TResult<const T&, ELookupError>(ResultHelpers::Err, ELookupError::NotFound);
+}
+
+/**
+ * Same as TryFind but also raises an ensure when the key is missing
+ * For lookups that are expected to succeed, the caller still gets a recoverable Err
+ */
+template<typename ContainerType, typename KeyType>
+auto TryFindChecked(ContainerType& Container, const KeyType& Key) -> decltype(TryFind(Container, Key))
+{
+    auto Result = TryFind(Container, Key);
+    ensureMsgf(Result.IsOk(), TEXT("TryFindChecked: key not found"));
+    return Result;
+}
+
+/** Same as TryGet but also raises an ensure when the index is out of range */
+template<typename ContainerType>
+auto TryGetChecked(ContainerType& Container, int32 Index) -> decltype(TryGet(Container, Index))
+{
+    auto Result = TryGet(Container, Index);
+    ensureMsgf(Result.IsOk(), TEXT("TryGetChecked: index %d out of range"), Index);
+    return Result;
+}
@@ -0,0 +1,196 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ResultType/Result.h"
+
+enum class EResultDiagnosticSeverity : uint8
+{
+    Info,
+    Warning,
+};
+
+/** A non-fatal note attached to a result */
+struct FResultDiagnostic
+{
+    EResultDiagnosticSeverity Severity = EResultDiagnosticSeverity::Warning;
+    FString Message;
+
+    bool operator==(const FResultDiagnostic& Other) const
+    {
+        return Severity == Other.Severity && Message == Other.Message;
+    }
+};
+
+// An empty TArray owns no allocation, so results without diagnostics stay free
+using FResultDiagnostics = TArray<FResultDiagnostic>;
+
+template<typename T, typename E>
+class TDiagnosticResult;
+
+namespace ResultHelpers
+{
+    template<typename R>
+    struct TIsDiagnosticResult
+    {
+        static constexpr bool Value = false;
+    };
+
+    template<typename T, typename E>
+    struct TIsDiagnosticResult<TDiagnosticResult<T, E>>
+    {
+        static constexpr bool Value = true;
+    };
+}
+
+/**
+ * A TResult carrying a side channel of non-fatal diagnostics (warnings, notes)
+ * Diagnostics are forwarded through Map/MapErr/AndThen and merged with those of chained results
+ */
+template<typename T, typename E>
+class TDiagnosticResult
+{
+private:
+    TResult<T, E> Result;
+    FResultDiagnostics Diagnostics;
+
+public:
+
+    using OkValueType = T;
+    using ErrValueType = E;
+
+    // Constructors
+    TDiagnosticResult(const ResultHelpers::OkTag& InTag, const T& Value) : Result(InTag, Value) {}
+    TDiagnosticResult(const ResultHelpers::OkTag& InTag, T&& Value) : Result(InTag, MoveTemp(Value)) {}
+
+    TDiagnosticResult(const ResultHelpers::ErrTag& InTag, const E& Error) : Result(InTag, Error) {}
+    TDiagnosticResult(const ResultHelpers::ErrTag& InTag, E&& Error) : Result(InTag, MoveTemp(Error)) {}
+
+    TDiagnosticResult(TResult<T, E> InResult, FResultDiagnostics InDiagnostics = FResultDiagnostics())
+        : Result(MoveTemp(InResult))
+        , Diagnostics(MoveTemp(InDiagnostics))
+    {
+    }
+
+    // Recording diagnostics
+    TDiagnosticResult& AddDiagnostic(EResultDiagnosticSeverity Severity, FString Message)
+    {
+        Diagnostics.Add(FResultDiagnostic{Severity, MoveTemp(Message)});
+        return *this;
+    }
+
+    TDiagnosticResult& Warn(FString Message)
+    {
+        return AddDiagnostic(EResultDiagnosticSeverity::Warning, MoveTemp(Message));
+    }
+
+    TDiagnosticResult& Note(FString Message)
+    {
+        return AddDiagnostic(EResultDiagnosticSeverity::Info, MoveTemp(Message));
+    }
+
+    void AppendDiagnostics(const FResultDiagnostics& Other)
+    {
+        Diagnostics.Append(Other);
+    }
+
+    bool HasDiagnostics() const { return Diagnostics.Num() > 0; }
+    bool HasWarnings() const
+    {
+        return Diagnostics.ContainsByPredicate([](const FResultDiagnostic& Diagnostic)
+        {
+            return Diagnostic.Severity == EResultDiagnosticSeverity::Warning;
+        });
+    }
+
+    const FResultDiagnostics& GetDiagnostics() const { return Diagnostics; }
+
+    // Accessing the underlying result
+    const TResult<T, E>& GetResult() const { return Result; }
+
+    bool IsOk() const { return Result.IsOk(); }
+    bool IsErr() const { return Result.IsErr(); }
+
+    const T& Unwrap() const { return Result.Unwrap(); }
+    const T& Expect(const TCHAR* Message) const { return Result.Expect(Message); }
+    T UnwrapOr(const T& DefaultValue) const { return Result.UnwrapOr(DefaultValue); }
+    const E& UnwrapErr() const { return Result.UnwrapErr(); }
+    const E& ExpectErr(const TCHAR* Message) const { return Result.ExpectErr(Message); }
+
+    // Transforming contained values, diagnostics are carried along
+    template<typename F>
+    TDiagnosticResult<TInvokeResult_T<F, T>, E> Map(F&& Func) const &
+    {
+        return TDiagnosticResult<TInvokeResult_T<F, T>, E>(Result.Map(Forward<F>(Func)), Diagnostics);
+    }
+
+    template<typename F>
+    TDiagnosticResult<TInvokeResult_T<F, T>, E> Map(F&& Func) &&
+    {
+        return TDiagnosticResult<TInvokeResult_T<F, T>, E>(Result.Map(Forward<F>(Func)), MoveTemp(Diagnostics));
+    }
+
+    template<typename F>
+    TDiagnosticResult<T, TInvokeResult_T<F, E>> MapErr(F&& Func) const &
+    {
+        return TDiagnosticResult<T, TInvokeResult_T<F, E>>(Result.MapErr(Forward<F>(Func)), Diagnostics);
+    }
+
+    template<typename F>
+    TDiagnosticResult<T, TInvokeResult_T<F, E>> MapErr(F&& Func) &&
+    {
+        return TDiagnosticResult<T, TInvokeResult_T<F, E>>(Result.MapErr(Forward<F>(Func)), MoveTemp(Diagnostics));
+    }
+
+    /** Func may return either a TResult or a TDiagnosticResult, diagnostics of both sides are merged */
+    template<typename F>
+    TDiagnosticResult<typename TInvokeResult_T<F, T>::OkValueType, E> AndThen(F&& Func) const &
+    {
+        return AndThenImpl(Forward<F>(Func), FResultDiagnostics(Diagnostics));
+    }
+
+    template<typename F>
+    TDiagnosticResult<typename TInvokeResult_T<F, T>::OkValueType, E> AndThen(F&& Func) &&
+    {
+        return AndThenImpl(Forward<F>(Func), MoveTemp(Diagnostics));
+    }
+
+    // Conversion, drops the diagnostics
+    TResult<T, E> ToResult() const { return Result; }
+
+    bool operator==(const TDiagnosticResult& Other) const
+    {
+        return Result == Other.Result && Diagnostics == Other.Diagnostics;
+    }
+
+    bool operator!=(const TDiagnosticResult& Other) const
+    {
+        return !(*this == Other);
+    }
+
+private:
+
+    template<typename F>
+    TDiagnosticResult<typename TInvokeResult_T<F, T>::OkValueType, E> AndThenImpl(F&& Func, FResultDiagnostics&& InDiagnostics) const
+    {
+        using FReturnType = TInvokeResult_T<F, T>;
+        using FOutType = TDiagnosticResult<typename FReturnType::OkValueType, E>;
+
+        if (Result.IsErr())
+        {
+            return FOutType(TResult<typename FReturnType::OkValueType, E>(ResultHelpers::Err, Result.UnwrapErr()), MoveTemp(InDiagnostics));
+        }
+
+        if constexpr (ResultHelpers::TIsDiagnosticResult<FReturnType>::Value)
+        {
+            FReturnType Next = Func(Result.Unwrap());
+            InDiagnostics.Append(Next.GetDiagnostics());
+            return FOutType(Next.GetResult(), MoveTemp(InDiagnostics));
+        }
+        else
+        {
+            return FOutType(Func(Result.Unwrap()), MoveTemp(InDiagnostics));
+        }
+    }
+};
@@ -0,0 +1,100 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "ResultType/AnyError.h"
+
+/** Source location errors are aggregated under */
+struct FErrorSite
+{
+    const ANSICHAR* File = nullptr;
+    int32 Line = 0;
+};
+
+/** Errors of one site and code within a frame */
+struct FErrorFrameEntry
+{
+    const FErrorSite* Site = nullptr;
+    int32 Code = 0;
+    int32 Count = 0;
+
+    /** Number of threads that reported the error */
+    int32 ThreadCount = 0;
+
+    /** First error recorded on the first reporting thread, kept for its message */
+    FAnyError FirstError;
+};
+
+struct FErrorFrameReport
+{
+    uint64 FrameIndex = 0;
+    int32 TotalCount = 0;
+
+    /** Sorted by descending count */
+    TArray<FErrorFrameEntry> Entries;
+};
+
+/**
+ * Collects errors per thread and merges them into one report per frame
+ * Each thread records into its own cache-line aligned buffer, so concurrent reporters never share a lock or a line.
+ * A buffer is shared between the aggregator and its thread, and is dropped at the first EndFrame after the thread has
+ * exited. Call EndFrame at the frame sync point, for example from FCoreDelegates::OnEndFrame.
+ */
+class RESULTERRORHANDLINGTYPE_API FErrorAggregator
+{
+public:
+
+    UE_NONCOPYABLE(FErrorAggregator);
+
+    /** Shared aggregator */
+    static FErrorAggregator& Get();
+
+    FErrorAggregator();
+    ~FErrorAggregator();
+
+    /** Counts the error under its site and code, only the first occurrence per thread and frame is copied */
+    template<typename E>
+    void Record(const FErrorSite& Site, const E& Error)
+    {
+        RecordErased(Site, TAnyErrorTraits<E>::GetErrorCode(Error), &Error, [](const void* Object)
+        {
+            return FAnyError(*static_cast<const E*>(Object));
+        });
+    }
+
+    /** Moves every thread's errors into a report and starts the next frame */
+    FErrorFrameReport EndFrame();
+
+    uint64 GetFrameIndex() const;
+
+    /** Number of thread buffers kept, one per thread that recorded since the last EndFrame or is still running */
+    int32 GetThreadBufferCount() const;
+
+private:
+
+    struct FThreadBuffer;
+    using FThreadBufferPtr = TSharedPtr<FThreadBuffer, ESPMode::ThreadSafe>;
+
+    void RecordErased(const FErrorSite& Site, int32 Code, const void* Error, FAnyError (*MakeError)(const void*));
+    FThreadBuffer& GetThreadBuffer();
+
+    /** Unique across the process lifetime, so thread caches never match a destroyed aggregator at the same address */
+    const uint64 Id;
+
+    mutable FCriticalSection RegistryLock;
+    TArray<FThreadBufferPtr> Buffers;
+    uint64 FrameIndex = 0;
+};
+
+/**
+ * Error callback for InspectErr that records into an aggregator, every expansion is its own site
+ * Result.InspectErr(RESULT_AGGREGATE_ERR(FErrorAggregator::Get()));
+ */
+#define RESULT_AGGREGATE_ERR(Aggregator) \
+    [&Target = (Aggregator)](const auto& Error) \
+    { \
+        static const FErrorSite Site{__FILE__, __LINE__}; \
+        Target.Record(Site, Error); \
+    }
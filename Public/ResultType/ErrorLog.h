@@ -0,0 +1,163 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Queue.h"
+#include "HAL/PlatformTime.h"
+#include "Templates/Function.h"
+#include "ResultType/AnyError.h"
+
+#include <atomic>
+
+class FEvent;
+
+/**
+ * Call site of an error log, rate limited by a token bucket refilled at RatePerSecond and holding up to Burst tokens
+ * The bucket is kept as the time at which it will be full again, so taking a token is one compare and swap.
+ */
+class FErrorLogSite
+{
+public:
+
+    UE_NONCOPYABLE(FErrorLogSite);
+
+    /** A rate of zero or less disables the limit */
+    FErrorLogSite(const ANSICHAR* InFile, int32 InLine, float RatePerSecond = 10.0f, int32 Burst = 20)
+        : File(InFile)
+        , Line(InLine)
+        , CyclesPerToken(RatePerSecond > 0.0f ? static_cast<int64>(1.0 / (RatePerSecond * FPlatformTime::GetSecondsPerCycle64())) : 0)
+        , BurstCycles(CyclesPerToken * FMath::Max(Burst - 1, 0))
+    {
+    }
+
+    /** Takes a token, or counts the record as suppressed when the bucket is empty */
+    bool TryAcquire()
+    {
+        const int64 Now = static_cast<int64>(FPlatformTime::Cycles64());
+        int64 FullAt = FullAtCycles.load(std::memory_order_relaxed);
+        while (true)
+        {
+            const int64 Start = FMath::Max(FullAt, Now);
+            if (Start - Now > BurstCycles)
+            {
+                Suppressed.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            if (FullAtCycles.compare_exchange_weak(FullAt, Start + CyclesPerToken, std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+    }
+
+    /** Number of records suppressed since the last call */
+    int32 TakeSuppressedCount() { return Suppressed.exchange(0, std::memory_order_relaxed); }
+
+    const ANSICHAR* GetFile() const { return File; }
+    int32 GetLine() const { return Line; }
+
+private:
+
+    const ANSICHAR* File;
+    int32 Line;
+    int64 CyclesPerToken;
+    int64 BurstCycles;
+    std::atomic<int64> FullAtCycles{0};
+    std::atomic<int32> Suppressed{0};
+};
+
+/** One line written by the sink, covering a run of identical consecutive errors */
+struct RESULTERRORHANDLINGTYPE_API FErrorLogEntry
+{
+    const FErrorLogSite* Site = nullptr;
+    FString Message;
+    int32 Code = 0;
+
+    /** Number of identical consecutive errors merged into this entry */
+    int32 Repeats = 1;
+
+    /** Errors dropped by the site's rate limit before this entry */
+    int32 Suppressed = 0;
+
+    /** Formats as "File(Line): Message [Code] (xRepeats) (Suppressed suppressed)" */
+    FString ToString() const;
+};
+
+/**
+ * Asynchronous error log
+ * Submit only takes a token from the site and queues the type-erased error, message formatting, deduplication
+ * and output run on a background thread. Identical consecutive errors from one site are merged into one entry.
+ */
+class RESULTERRORHANDLINGTYPE_API FErrorLogSink
+{
+public:
+
+    using FOutput = TUniqueFunction<void(const FErrorLogEntry&)>;
+
+    UE_NONCOPYABLE(FErrorLogSink);
+
+    /** Shared sink writing to LogTemp, created on first use and stopped by the module at shutdown */
+    static FErrorLogSink& Get();
+
+    /** Stops the shared sink if it was ever created, while the log it writes to is still up */
+    static void StopShared();
+
+    /** Errors of a run are held for up to CoalesceSeconds waiting for repeats, the default output writes to LogTemp */
+    explicit FErrorLogSink(FOutput&& InOutput = nullptr, float InCoalesceSeconds = 0.1f);
+
+    /** Writes every queued error before returning */
+    ~FErrorLogSink();
+
+    template<typename E>
+    void Submit(FErrorLogSite& Site, const E& Error)
+    {
+        if (Site.TryAcquire())
+        {
+            Enqueue(Site, FAnyError(Error));
+        }
+    }
+
+    /** Blocks until every error submitted before the call has been written */
+    void Flush();
+
+    /** Writes every queued error and stops the worker, errors submitted afterwards are dropped */
+    void Stop();
+
+private:
+
+    struct FRecord
+    {
+        FErrorLogSite* Site = nullptr;
+        FAnyError Error;
+        int32 Suppressed = 0;
+    };
+
+    void Enqueue(FErrorLogSite& Site, FAnyError&& Error);
+    void Run();
+
+    TQueue<FRecord, EQueueMode::Mpsc> Queue;
+    FOutput Output;
+    double CoalesceSeconds;
+
+    FEvent* WorkAvailable = nullptr;
+    TFuture<void> Worker;
+
+    std::atomic<uint64> SubmittedCount{0};
+    std::atomic<uint64> WrittenCount{0};
+    std::atomic<int32> FlushWaiters{0};
+    std::atomic<bool> bWorkerIdle{false};
+    std::atomic<bool> bStopping{false};
+};
+
+/**
+ * Error callback for InspectErr that logs through the shared sink, every expansion is its own rate limited site
+ * Result.InspectErr(RESULT_LOG_ERR(5.0f, 10));
+ */
+#define RESULT_LOG_ERR(RatePerSecond, Burst) \
+    [](const auto& Error) \
+    { \
+        static FErrorLogSite Site(__FILE__, __LINE__, RatePerSecond, Burst); \
+        FErrorLogSink::Get().Submit(Site, Error); \
+    }
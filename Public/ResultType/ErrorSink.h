@@ -0,0 +1,110 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ResultType/Result.h"
+
+/**
+ * Thread-local sink that hot kernels report failures into instead of returning a TResult
+ * Keeps the first reported error and the number of reports, a TErrorSinkScope turns it into a TResult
+ * The state lives in a function-local thread_local of this header template, so in modular builds every module
+ * gets its own instance : report and open the TErrorSinkScope from the same module.
+ */
+template<typename E>
+class TErrorSink
+{
+public:
+
+    struct FState
+    {
+        E FirstError = E();
+        int32 Count = 0;
+    };
+
+    static void Report(const E& Error)
+    {
+        FState& State = GetThreadState();
+        if (State.Count++ == 0)
+        {
+            State.FirstError = Error;
+        }
+    }
+
+    /** Branch-light reporting, MakeError is only invoked for the first failure */
+    template<typename F>
+    static void ReportIf(bool bFailed, F&& MakeError)
+    {
+        FState& State = GetThreadState();
+        State.Count += static_cast<int32>(bFailed);
+        if (UNLIKELY(bFailed && State.Count == 1))
+        {
+            State.FirstError = MakeError();
+        }
+    }
+
+    static bool HasErrors() { return GetThreadState().Count > 0; }
+    static int32 GetErrorCount() { return GetThreadState().Count; }
+
+    static FState& GetThreadState()
+    {
+        static thread_local FState State;
+        return State;
+    }
+};
+
+/**
+ * Scope guard isolating the calling thread's TErrorSink<E> for the duration of a kernel
+ * The enclosing scope's state is restored on destruction so scopes can nest
+ */
+template<typename E>
+class TErrorSinkScope
+{
+public:
+
+    TErrorSinkScope()
+        : SavedState(MoveTemp(TErrorSink<E>::GetThreadState()))
+    {
+        TErrorSink<E>::GetThreadState() = typename TErrorSink<E>::FState();
+    }
+
+    ~TErrorSinkScope()
+    {
+        TErrorSink<E>::GetThreadState() = MoveTemp(SavedState);
+    }
+
+    TErrorSinkScope(const TErrorSinkScope&) = delete;
+    TErrorSinkScope& operator=(const TErrorSinkScope&) = delete;
+
+    bool HasErrors() const { return TErrorSink<E>::HasErrors(); }
+    int32 GetErrorCount() const { return TErrorSink<E>::GetErrorCount(); }
+
+    /** Converts the sink state into a result and clears it */
+    template<typename T>
+    TResult<TDecay_T<T>, E> Finish(T&& Value)
+    {
+        typename TErrorSink<E>::FState& State = TErrorSink<E>::GetThreadState();
+        if (State.Count > 0)
+        {
+            TResult<TDecay_T<T>, E> Result(ResultHelpers::Err, MoveTemp(State.FirstError));
+            State = typename TErrorSink<E>::FState();
+            return Result;
+        }
+        return TResult<TDecay_T<T>, E>(ResultHelpers::Ok, Forward<T>(Value));
+    }
+
+private:
+
+    typename TErrorSink<E>::FState SavedState;
+};
+
+namespace ResultHelpers
+{
+    /** Runs Func inside a fresh TErrorSinkScope<E> and returns its value or the first reported error */
+    template<typename E, typename F>
+    TResult<TInvokeResult_T<F>, E> CaptureErrors(F&& Func)
+    {
+        TErrorSinkScope<E> Scope;
+        return Scope.Finish(Func());
+    }
+}
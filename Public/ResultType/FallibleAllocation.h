@@ -0,0 +1,214 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ResultType/Result.h"
+
+enum class EAllocError : uint8
+{
+    OutOfMemory,
+    InvalidSize,
+};
+
+/**
+ * Allocation entry points that report failure instead of raising an out-of-memory fatal error
+ * Owns an optional emergency reserve that is released on the first failure so error handling can still allocate
+ */
+struct RESULTERRORHANDLINGTYPE_API FFallibleMemory
+{
+    /** Memory returned on success must be released with FMemory::Free */
+    static TResult<void*, EAllocError> TryMalloc(SIZE_T Count, uint32 Alignment = DEFAULT_ALIGNMENT);
+    static TResult<void*, EAllocError> TryRealloc(void* Original, SIZE_T Count, uint32 Alignment = DEFAULT_ALIGNMENT);
+
+    /** Checks that Count bytes could currently be allocated without keeping them */
+    static TVoidResult<EAllocError> TryProbe(SIZE_T Count, uint32 Alignment = DEFAULT_ALIGNMENT);
+
+    // Emergency reserve
+    static void InitEmergencyReserve(SIZE_T Size);
+    static bool ReleaseEmergencyReserve();
+    static bool HasEmergencyReserve();
+};
+
+namespace ResultHelpers
+{
+    // Mirrors the default TArray slack growth so repeated TryAdd calls stay amortized
+    inline int32 GrowCapacity(int32 CurrentMax, int32 Required)
+    {
+        const int64 Grown = static_cast<int64>(CurrentMax) + 3 * static_cast<int64>(CurrentMax) / 8 + 16;
+        return static_cast<int32>(FMath::Min<int64>(FMath::Max<int64>(Grown, Required), MAX_int32));
+    }
+
+    inline TVoidResult<EAllocError> CheckedBytes(int64 Count, SIZE_T ElementSize, SIZE_T& OutBytes)
+    {
+        if (Count < 0 || static_cast<uint64>(Count) > TNumericLimits<SIZE_T>::Max() / ElementSize)
+        {
+            return TVoidResult<EAllocError>(Err, EAllocError::InvalidSize);
+        }
+        OutBytes = static_cast<SIZE_T>(Count) * ElementSize;
+        return TVoidResult<EAllocError>(Ok, Unit);
+    }
+
+    /** Allocators that grow through FMemory::Realloc, the only ones whose growth is probed */
+    template<typename Allocator>
+    struct TIsHeapAllocator
+    {
+        static constexpr bool Value = false;
+    };
+
+    template<int IndexSize, typename... Rest>
+    struct TIsHeapAllocator<TSizedHeapAllocator<IndexSize, Rest...>>
+    {
+        static constexpr bool Value = true;
+    };
+
+    template<int IndexSize>
+    struct TIsHeapAllocator<TSizedDefaultAllocator<IndexSize>>
+    {
+        static constexpr bool Value = true;
+    };
+
+    template<>
+    struct TIsHeapAllocator<FDefaultSetAllocator>
+    {
+        static constexpr bool Value = true;
+    };
+
+    // A realloc that cannot grow in place holds the old and the new block at once, so both are probed together
+    inline TVoidResult<EAllocError> ProbeGrowth(SIZE_T CurrentBytes, SIZE_T NewBytes, uint32 Alignment)
+    {
+        if (NewBytes > TNumericLimits<SIZE_T>::Max() - CurrentBytes)
+        {
+            return TVoidResult<EAllocError>(Err, EAllocError::InvalidSize);
+        }
+        return FFallibleMemory::TryProbe(CurrentBytes + NewBytes, Alignment);
+    }
+
+    // Estimated per-element footprint of a set or map: element, hash chain link and hash bucket
+    template<typename ElementType>
+    constexpr SIZE_T SetElementBytes()
+    {
+        return sizeof(ElementType) + 3 * sizeof(int32);
+    }
+}
+
+/**
+ * Fallible container growth, best effort
+ * Before a heap-allocated container grows, one block the size of its current and new allocations is probed
+ * with FFallibleMemory, so a growth that cannot fit is reported as EAllocError::OutOfMemory. The containers
+ * cannot adopt the probed block, so another thread may still take the memory before the real allocation and
+ * the growth can still raise the out-of-memory fatal error. Only growth probes, so the extra allocation is
+ * amortized like the growth itself. Containers with inline or fixed allocators are grown without a probe.
+ */
+
+// TArray
+template<typename T, typename Allocator>
+TVoidResult<EAllocError> TryReserve(TArray<T, Allocator>& Array, int32 Number)
+{
+    SIZE_T Bytes = 0;
+    TVoidResult<EAllocError> SizeCheck = ResultHelpers::CheckedBytes(Number, sizeof(T), Bytes);
+    if (SizeCheck.IsErr() || Number <= Array.Max())
+    {
+        return SizeCheck;
+    }
+
+    if constexpr (ResultHelpers::TIsHeapAllocator<Allocator>::Value)
+    {
+        TVoidResult<EAllocError> Probe = ResultHelpers::ProbeGrowth(static_cast<SIZE_T>(Array.Max()) * sizeof(T), Bytes, alignof(T));
+        if (Probe.IsErr())
+        {
+            return Probe;
+        }
+    }
+    Array.Reserve(Number);
+    return SizeCheck;
+}
+
+template<typename T, typename Allocator>
+TResult<int32, EAllocError> TryAddUninitialized(TArray<T, Allocator>& Array, int32 Count = 1)
+{
+    if (Count < 0 || Array.Num() > MAX_int32 - Count)
+    {
+        return TResult<int32, EAllocError>(ResultHelpers::Err, EAllocError::InvalidSize);
+    }
+
+    const int32 Required = Array.Num() + Count;
+    if (Required > Array.Max())
+    {
+        TVoidResult<EAllocError> Reserved = TryReserve(Array, ResultHelpers::GrowCapacity(Array.Max(), Required));
+        if (Reserved.IsErr())
+        {
+            return TResult<int32, EAllocError>(ResultHelpers::Err, Reserved.UnwrapErr());
+        }
+    }
+    return TResult<int32, EAllocError>(ResultHelpers::Ok, Array.AddUninitialized(Count));
+}
+
+template<typename T, typename Allocator, typename ItemType>
+TResult<int32, EAllocError> TryAdd(TArray<T, Allocator>& Array, ItemType&& Item)
+{
+    if (Array.Num() == Array.Max())
+    {
+        TVoidResult<EAllocError> Reserved = TryReserve(Array, ResultHelpers::GrowCapacity(Array.Max(), Array.Num() + 1));
+        if (Reserved.IsErr())
+        {
+            return TResult<int32, EAllocError>(ResultHelpers::Err, Reserved.UnwrapErr());
+        }
+    }
+    return TResult<int32, EAllocError>(ResultHelpers::Ok, Array.Add(Forward<ItemType>(Item)));
+}
+
+template<typename T, typename Allocator>
+TVoidResult<EAllocError> TryResize(TArray<T, Allocator>& Array, int32 NewNum)
+{
+    TVoidResult<EAllocError> Reserved = TryReserve(Array, NewNum);
+    if (Reserved.IsOk())
+    {
+        Array.SetNum(NewNum);
+    }
+    return Reserved;
+}
+
+// TMap
+template<typename K, typename V, typename SetAllocator, typename KeyFuncs>
+TVoidResult<EAllocError> TryReserve(TMap<K, V, SetAllocator, KeyFuncs>& Map, int32 Number)
+{
+    using FElementType = typename TMap<K, V, SetAllocator, KeyFuncs>::ElementType;
+
+    SIZE_T Bytes = 0;
+    TVoidResult<EAllocError> SizeCheck = ResultHelpers::CheckedBytes(Number, ResultHelpers::SetElementBytes<FElementType>(), Bytes);
+    if (SizeCheck.IsErr() || Number <= Map.Num())
+    {
+        return SizeCheck;
+    }
+
+    if constexpr (ResultHelpers::TIsHeapAllocator<SetAllocator>::Value)
+    {
+        TVoidResult<EAllocError> Probe = ResultHelpers::ProbeGrowth(Map.GetAllocatedSize(), Bytes, alignof(FElementType));
+        if (Probe.IsErr())
+        {
+            return Probe;
+        }
+    }
+    Map.Reserve(Number);
+    return SizeCheck;
+}
+
+template<typename K, typename V, typename SetAllocator, typename KeyFuncs, typename KeyType, typename ValueType>
+TResult<V&, EAllocError> TryAdd(TMap<K, V, SetAllocator, KeyFuncs>& Map, KeyType&& Key, ValueType&& Value)
+{
+    using FElementType = typename TMap<K, V, SetAllocator, KeyFuncs>::ElementType;
+
+    // Only probe when the current allocation cannot hold another element
+    const SIZE_T RequiredBytes = static_cast<SIZE_T>(Map.Num() + 1) * ResultHelpers::SetElementBytes<FElementType>();
+    if (ResultHelpers::TIsHeapAllocator<SetAllocator>::Value && RequiredBytes > Map.GetAllocatedSize())
+    {
+        const SIZE_T GrownBytes = static_cast<SIZE_T>(ResultHelpers::GrowCapacity(Map.Num(), Map.Num() + 1)) * ResultHelpers::SetElementBytes<FElementType>();
+        TVoidResult<EAllocError> Probe = ResultHelpers::ProbeGrowth(Map.GetAllocatedSize(), GrownBytes, alignof(FElementType));
+        if (Probe.IsErr())
+        {
+            return TResult<V&, EAllocError>(ResultHelpers::Err, Probe.UnwrapErr());
+        }
+    }
+    return TResult<V&, EAllocError>(ResultHelpers::Ok, Map.Add(Forward<KeyType>(Key), Forward<ValueType>(Value)));
+}
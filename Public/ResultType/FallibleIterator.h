@@ -0,0 +1,342 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Optional.h"
+#include "ResultType/Result.h"
+
+/*
+ * Fallible iterator protocol
+ * Any type with a TryNext() returning TResult<TOptional<T>, E> is a fallible iterator: an Ok value holds the next
+ * item, an unset Ok value marks the end and an error means the source failed mid-iteration. Callers stop at the
+ * first error. The adaptors below pull one item at a time and never buffer more than a chunk, they borrow an
+ * iterator passed as an lvalue and take ownership of one passed as an rvalue.
+ */
+
+namespace ResultHelpers
+{
+    template<typename R>
+    struct TIsResult
+    {
+        static constexpr bool Value = false;
+    };
+
+    template<typename T, typename E>
+    struct TIsResult<TResult<T, E>>
+    {
+        static constexpr bool Value = true;
+    };
+
+    /** Value produced by an adaptor function, which may return either the value or a TResult of it */
+    template<typename R>
+    struct TTryValue
+    {
+        using Type = R;
+    };
+
+    template<typename T, typename E>
+    struct TTryValue<TResult<T, E>>
+    {
+        using Type = T;
+    };
+
+    template<typename R>
+    struct TTryNextItem;
+
+    template<typename T, typename E>
+    struct TTryNextItem<TResult<TOptional<T>, E>>
+    {
+        using ItemType = T;
+        using ErrorType = E;
+    };
+
+    /** Item and error types of a fallible iterator, deduced from its TryNext */
+    template<typename I>
+    struct TTryNextTraits : TTryNextItem<TDecay_T<decltype(DeclVal<TDecay_T<I>&>().TryNext())>>
+    {
+    };
+}
+
+/** Transforms each item, a function returning a TResult ends the iteration with its error */
+template<typename I, typename F>
+class TTryMapIterator
+{
+public:
+
+    using T = typename ResultHelpers::TTryNextTraits<I>::ItemType;
+    using E = typename ResultHelpers::TTryNextTraits<I>::ErrorType;
+    using FMapped = TDecay_T<TInvokeResult_T<F&, T&&>>;
+    using U = typename ResultHelpers::TTryValue<FMapped>::Type;
+
+    TTryMapIterator(I&& InUpstream, F&& InFunc)
+        : Upstream(Forward<I>(InUpstream))
+        , Func(MoveTemp(InFunc))
+    {
+    }
+
+    TResult<TOptional<U>, E> TryNext()
+    {
+        TResult<TOptional<T>, E> Item = Upstream.TryNext();
+        if (Item.IsErr())
+        {
+            return TResult<TOptional<U>, E>(ResultHelpers::Err, Item.UnwrapErr());
+        }
+
+        TOptional<T> Value = Item.MoveUnwrap();
+        if (!Value.IsSet())
+        {
+            return TResult<TOptional<U>, E>(ResultHelpers::Ok, TOptional<U>());
+        }
+
+        if constexpr (ResultHelpers::TIsResult<FMapped>::Value)
+        {
+            FMapped Mapped = Func(MoveTemp(Value.GetValue()));
+            if (Mapped.IsErr())
+            {
+                return TResult<TOptional<U>, E>(ResultHelpers::Err, Mapped.UnwrapErr());
+            }
+            return TResult<TOptional<U>, E>(ResultHelpers::Ok, TOptional<U>(Mapped.MoveUnwrap()));
+        }
+        else
+        {
+            return TResult<TOptional<U>, E>(ResultHelpers::Ok, TOptional<U>(Func(MoveTemp(Value.GetValue()))));
+        }
+    }
+
+private:
+
+    I Upstream;
+    F Func;
+};
+
+/** Skips items the predicate rejects, a predicate returning TResult<bool, E> ends the iteration with its error */
+template<typename I, typename P>
+class TTryFilterIterator
+{
+public:
+
+    using T = typename ResultHelpers::TTryNextTraits<I>::ItemType;
+    using E = typename ResultHelpers::TTryNextTraits<I>::ErrorType;
+    using FVerdict = TDecay_T<TInvokeResult_T<P&, const T&>>;
+
+    TTryFilterIterator(I&& InUpstream, P&& InPredicate)
+        : Upstream(Forward<I>(InUpstream))
+        , Predicate(MoveTemp(InPredicate))
+    {
+    }
+
+    TResult<TOptional<T>, E> TryNext()
+    {
+        while (true)
+        {
+            TResult<TOptional<T>, E> Item = Upstream.TryNext();
+            if (Item.IsErr() || !Item.Unwrap().IsSet())
+            {
+                return Item;
+            }
+
+            if constexpr (ResultHelpers::TIsResult<FVerdict>::Value)
+            {
+                FVerdict Verdict = Predicate(Item.Unwrap().GetValue());
+                if (Verdict.IsErr())
+                {
+                    return TResult<TOptional<T>, E>(ResultHelpers::Err, Verdict.UnwrapErr());
+                }
+                if (Verdict.Unwrap())
+                {
+                    return Item;
+                }
+            }
+            else if (Predicate(Item.Unwrap().GetValue()))
+            {
+                return Item;
+            }
+        }
+    }
+
+private:
+
+    I Upstream;
+    P Predicate;
+};
+
+/** Groups items into arrays of up to Size, a partial chunk is returned before the error that cut it short */
+template<typename I>
+class TTryChunksIterator
+{
+public:
+
+    using T = typename ResultHelpers::TTryNextTraits<I>::ItemType;
+    using E = typename ResultHelpers::TTryNextTraits<I>::ErrorType;
+
+    TTryChunksIterator(I&& InUpstream, int32 InSize)
+        : Upstream(Forward<I>(InUpstream))
+        , Size(FMath::Max(InSize, 1))
+    {
+    }
+
+    TResult<TOptional<TArray<T>>, E> TryNext()
+    {
+        using FNext = TResult<TOptional<TArray<T>>, E>;
+
+        if (PendingError.IsSet())
+        {
+            FNext Error(ResultHelpers::Err, PendingError.GetValue());
+            PendingError.Reset();
+            return Error;
+        }
+
+        TArray<T> Chunk;
+        Chunk.Reserve(Size);
+        while (Chunk.Num() < Size)
+        {
+            TResult<TOptional<T>, E> Item = Upstream.TryNext();
+            if (Item.IsErr())
+            {
+                if (Chunk.Num() == 0)
+                {
+                    return FNext(ResultHelpers::Err, Item.UnwrapErr());
+                }
+                PendingError = Item.UnwrapErr();
+                break;
+            }
+
+            TOptional<T> Value = Item.MoveUnwrap();
+            if (!Value.IsSet())
+            {
+                break;
+            }
+            Chunk.Add(MoveTemp(Value.GetValue()));
+        }
+
+        if (Chunk.Num() == 0)
+        {
+            return FNext(ResultHelpers::Ok, TOptional<TArray<T>>());
+        }
+        return FNext(ResultHelpers::Ok, TOptional<TArray<T>>(MoveTemp(Chunk)));
+    }
+
+private:
+
+    I Upstream;
+    int32 Size;
+    TOptional<E> PendingError;
+};
+
+/**
+ * Single-pass ranged-for view of a fallible iterator
+ * The loop ends at the first error, which is kept for GetError and GetResult once the loop is done.
+ */
+template<typename I>
+class TTryRange
+{
+public:
+
+    using T = typename ResultHelpers::TTryNextTraits<I>::ItemType;
+    using E = typename ResultHelpers::TTryNextTraits<I>::ErrorType;
+
+    struct FEnd
+    {
+    };
+
+    class FIterator
+    {
+    public:
+
+        explicit FIterator(TTryRange& InRange)
+            : Range(InRange)
+        {
+        }
+
+        T& operator*() const { return Range.Current.GetValue(); }
+
+        FIterator& operator++()
+        {
+            Range.Advance();
+            return *this;
+        }
+
+        bool operator!=(FEnd) const { return Range.Current.IsSet(); }
+
+    private:
+
+        TTryRange& Range;
+    };
+
+    explicit TTryRange(I&& InIterator)
+        : Iterator(Forward<I>(InIterator))
+    {
+    }
+
+    FIterator begin()
+    {
+        Advance();
+        return FIterator(*this);
+    }
+
+    FEnd end() const { return FEnd(); }
+
+    bool HasError() const { return Error.IsSet(); }
+    const TOptional<E>& GetError() const { return Error; }
+
+    /** Ok if the iteration reached the end or was stopped early, the error that ended it otherwise */
+    TVoidResult<E> GetResult() const
+    {
+        if (Error.IsSet())
+        {
+            return TVoidResult<E>(ResultHelpers::Err, Error.GetValue());
+        }
+        return TVoidResult<E>(ResultHelpers::Ok, ResultHelpers::Unit);
+    }
+
+private:
+
+    void Advance()
+    {
+        if (Error.IsSet())
+        {
+            Current.Reset();
+            return;
+        }
+
+        TResult<TOptional<T>, E> Item = Iterator.TryNext();
+        if (Item.IsErr())
+        {
+            Error = Item.UnwrapErr();
+            Current.Reset();
+        }
+        else
+        {
+            Current = Item.MoveUnwrap();
+        }
+    }
+
+    I Iterator;
+    TOptional<T> Current;
+    TOptional<E> Error;
+};
+
+template<typename I, typename F>
+TTryMapIterator<I, TDecay_T<F>> TryMap(I&& Iterator, F&& Func)
+{
+    return TTryMapIterator<I, TDecay_T<F>>(Forward<I>(Iterator), TDecay_T<F>(Forward<F>(Func)));
+}
+
+template<typename I, typename P>
+TTryFilterIterator<I, TDecay_T<P>> TryFilter(I&& Iterator, P&& Predicate)
+{
+    return TTryFilterIterator<I, TDecay_T<P>>(Forward<I>(Iterator), TDecay_T<P>(Forward<P>(Predicate)));
+}
+
+template<typename I>
+TTryChunksIterator<I> TryChunks(I&& Iterator, int32 Size)
+{
+    return TTryChunksIterator<I>(Forward<I>(Iterator), Size);
+}
+
+template<typename I>
+TTryRange<I> TryIterate(I&& Iterator)
+{
+    return TTryRange<I>(Forward<I>(Iterator));
+}
@@ -0,0 +1,34 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EIoErrorKind : uint8
+{
+    NotFound,
+    PermissionDenied,
+    InvalidRange,
+    MappingFailed,
+    ShortRead,
+    ReadFailed,
+    Cancelled,
+    WriteFailed,
+    InvalidFormat,
+};
+
+/** File access failure, Offset is the byte position in the file the failing operation started at */
+struct FIoError
+{
+    EIoErrorKind Kind = EIoErrorKind::NotFound;
+    FString Path;
+    int64 Offset = 0;
+
+    RESULTERRORHANDLINGTYPE_API FString GetErrorMessage() const;
+    int32 GetErrorCode() const { return static_cast<int32>(Kind); }
+
+    bool operator==(const FIoError& Other) const
+    {
+        return Kind == Other.Kind && Offset == Other.Offset && Path == Other.Path;
+    }
+};
@@ -0,0 +1,264 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+#include "Containers/StringView.h"
+#include "ResultType/NumberParsing.h"
+#include "ResultType/Result.h"
+
+#include <type_traits>
+
+enum class EJsonTokenType : uint8
+{
+    ObjectStart,
+    ObjectEnd,
+    ArrayStart,
+    ArrayEnd,
+    Key,
+    String,
+    Number,
+    True,
+    False,
+    Null,
+    EndOfInput,
+};
+
+enum class EJsonErrorKind : uint8
+{
+    UnexpectedCharacter,
+    UnexpectedEnd,
+    InvalidString,
+    InvalidEscape,
+    InvalidNumber,
+    NestingTooDeep,
+    TypeMismatch,
+    OutOfRange,
+};
+
+/** JSON failure, Offset is a byte offset into the document, Line and Column are 1-based */
+struct FJsonError
+{
+    EJsonErrorKind Kind = EJsonErrorKind::UnexpectedCharacter;
+    int32 Offset = 0;
+    int32 Line = 1;
+    int32 Column = 1;
+
+    FString GetErrorMessage() const;
+    int32 GetErrorCode() const { return static_cast<int32>(Kind); }
+
+    bool operator==(const FJsonError& Other) const
+    {
+        return Kind == Other.Kind && Offset == Other.Offset && Line == Other.Line && Column == Other.Column;
+    }
+};
+
+/** Token pointing into the source bytes, keys and strings exclude the quotes and keep their escapes */
+struct FJsonToken
+{
+    EJsonTokenType Type = EJsonTokenType::EndOfInput;
+    FUtf8StringView Text;
+    int32 Offset = 0;
+    bool bHasEscapes = false;
+};
+
+/**
+ * Pull reader over a UTF-8 JSON document
+ * Tokens are produced on demand without building a DOM and strings are returned as views into the source,
+ * so the bytes must outlive the reader. The grammar is validated strictly; the first error is sticky and
+ * every later call returns it again. Line and column are only computed when an error is reported.
+ */
+class RESULTERRORHANDLINGTYPE_API FJsonPullReader
+{
+public:
+
+    static constexpr int32 MaxDepth = 512;
+
+    explicit FJsonPullReader(TArrayView<const uint8> InBytes);
+
+    TResult<FJsonToken, FJsonError> Next();
+    TResult<FJsonToken, FJsonError> Peek();
+
+    /** Skips the next value including everything nested in it, a pending key is skipped with its member's value */
+    TVoidResult<FJsonError> SkipValue();
+
+    int32 GetDepth() const { return Stack.Num(); }
+
+    FJsonError MakeError(EJsonErrorKind Kind, int32 ErrorOffset) const;
+
+    // Typed decoding of the next value
+    TResult<bool, FJsonError> ReadBool();
+    TResult<FString, FJsonError> ReadString();
+
+    /** Resolves escapes and converts a key or string token to TCHAR */
+    TResult<FString, FJsonError> DecodeString(const FJsonToken& Token) const;
+
+    template<typename T>
+    TResult<T, FJsonError> ReadNumber()
+    {
+        static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "ReadNumber requires a numeric type");
+
+        TResult<FJsonToken, FJsonError> Token = Next();
+        if (Token.IsErr())
+        {
+            return TResult<T, FJsonError>(ResultHelpers::Err, Token.UnwrapErr());
+        }
+
+        const FJsonToken& Number = Token.Unwrap();
+        if (Number.Type != EJsonTokenType::Number)
+        {
+            return Fail<T>(EJsonErrorKind::TypeMismatch, Number.Offset);
+        }
+
+        // Number tokens are validated ASCII, widen them for the TCHAR parsers
+        TArray<TCHAR, TInlineAllocator<64>> Wide;
+        Wide.SetNumUninitialized(Number.Text.Len());
+        for (int32 Index = 0; Index < Number.Text.Len(); ++Index)
+        {
+            Wide[Index] = static_cast<TCHAR>(Number.Text[Index]);
+        }
+
+        TResult<T, FParseError> Parsed = [&Wide]()
+        {
+            if constexpr (std::is_integral_v<T>)
+            {
+                return ParseInt<T>(FStringView(Wide.GetData(), Wide.Num()));
+            }
+            else
+            {
+                return ParseFloat<T>(FStringView(Wide.GetData(), Wide.Num()));
+            }
+        }();
+
+        if (Parsed.IsErr())
+        {
+            const FParseError& Error = Parsed.UnwrapErr();
+            return Fail<T>(Error.Kind == EParseErrorKind::Overflow ? EJsonErrorKind::OutOfRange : EJsonErrorKind::TypeMismatch, Number.Offset + Error.Offset);
+        }
+        return TResult<T, FJsonError>(ResultHelpers::Ok, Parsed.Unwrap());
+    }
+
+    /** Calls Visitor(KeyToken) for every member, the visitor must consume exactly one value */
+    template<typename VisitorType>
+    TVoidResult<FJsonError> ReadObject(VisitorType&& Visitor)
+    {
+        TResult<FJsonToken, FJsonError> Start = Next();
+        if (Start.IsErr())
+        {
+            return TVoidResult<FJsonError>(ResultHelpers::Err, Start.UnwrapErr());
+        }
+        if (Start.Unwrap().Type != EJsonTokenType::ObjectStart)
+        {
+            return Fail<ResultHelpers::FUnit>(EJsonErrorKind::TypeMismatch, Start.Unwrap().Offset);
+        }
+
+        while (true)
+        {
+            TResult<FJsonToken, FJsonError> Token = Next();
+            if (Token.IsErr())
+            {
+                return TVoidResult<FJsonError>(ResultHelpers::Err, Token.UnwrapErr());
+            }
+            if (Token.Unwrap().Type == EJsonTokenType::ObjectEnd)
+            {
+                return TVoidResult<FJsonError>(ResultHelpers::Ok, ResultHelpers::Unit);
+            }
+            if (Token.Unwrap().Type != EJsonTokenType::Key)
+            {
+                return Fail<ResultHelpers::FUnit>(EJsonErrorKind::TypeMismatch, Token.Unwrap().Offset);
+            }
+
+            const int32 TokensBefore = TokenCount;
+            TVoidResult<FJsonError> Member = Visitor(Token.Unwrap());
+            if (Member.IsErr())
+            {
+                return Member;
+            }
+            if (TokenCount == TokensBefore)
+            {
+                return Fail<ResultHelpers::FUnit>(EJsonErrorKind::TypeMismatch, Token.Unwrap().Offset);
+            }
+        }
+    }
+
+    /** Calls Visitor() for every element, the visitor must consume exactly one value */
+    template<typename VisitorType>
+    TVoidResult<FJsonError> ReadArray(VisitorType&& Visitor)
+    {
+        TResult<FJsonToken, FJsonError> Start = Next();
+        if (Start.IsErr())
+        {
+            return TVoidResult<FJsonError>(ResultHelpers::Err, Start.UnwrapErr());
+        }
+        if (Start.Unwrap().Type != EJsonTokenType::ArrayStart)
+        {
+            return Fail<ResultHelpers::FUnit>(EJsonErrorKind::TypeMismatch, Start.Unwrap().Offset);
+        }
+
+        while (true)
+        {
+            TResult<FJsonToken, FJsonError> Token = Peek();
+            if (Token.IsErr())
+            {
+                return TVoidResult<FJsonError>(ResultHelpers::Err, Token.UnwrapErr());
+            }
+            if (Token.Unwrap().Type == EJsonTokenType::ArrayEnd)
+            {
+                Next();
+                return TVoidResult<FJsonError>(ResultHelpers::Ok, ResultHelpers::Unit);
+            }
+
+            const int32 TokensBefore = TokenCount;
+            TVoidResult<FJsonError> Element = Visitor();
+            if (Element.IsErr())
+            {
+                return Element;
+            }
+            if (TokenCount == TokensBefore)
+            {
+                return Fail<ResultHelpers::FUnit>(EJsonErrorKind::TypeMismatch, Token.Unwrap().Offset);
+            }
+        }
+    }
+
+private:
+
+    enum class EState : uint8
+    {
+        Value,
+        FirstValueOrEnd,
+        Key,
+        FirstKeyOrEnd,
+        AfterValue,
+        Done,
+    };
+
+    template<typename T>
+    TResult<T, FJsonError> Fail(EJsonErrorKind Kind, int32 ErrorOffset)
+    {
+        bFailed = true;
+        StickyError = MakeError(Kind, ErrorOffset);
+        return TResult<T, FJsonError>(ResultHelpers::Err, StickyError);
+    }
+
+    TResult<FJsonToken, FJsonError> ReadToken();
+    TResult<FJsonToken, FJsonError> ReadKey();
+    TResult<FJsonToken, FJsonError> ReadValue();
+    TResult<FJsonToken, FJsonError> ScanString();
+    TResult<FJsonToken, FJsonError> ScanNumber();
+    TResult<FJsonToken, FJsonError> ScanLiteral(const char* Literal, int32 Length, EJsonTokenType Type);
+    TResult<FJsonToken, FJsonError> CloseContainer();
+
+    FJsonToken MakeToken(EJsonTokenType Type, int32 Start, int32 End) const;
+    void SkipWhitespace();
+
+    TArrayView<const uint8> Bytes;
+    int32 Position = 0;
+    int32 TokenCount = 0;
+    EState State = EState::Value;
+    TArray<uint8, TInlineAllocator<32>> Stack;
+    TOptional<TResult<FJsonToken, FJsonError>> PeekedToken;
+    bool bFailed = false;
+    FJsonError StickyError;
+};
@@ -0,0 +1,82 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/Optional.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/Function.h"
+#include "ResultType/Result.h"
+
+#include <atomic>
+
+/**
+ * Fallible value computed at most once, on first access
+ * The first caller runs the initializer while concurrent callers wait on a lock, later calls only read an atomic flag.
+ * The outcome, Ok or Err, is cached inside the object and the initializer is released once it has run.
+ */
+template<typename T, typename E>
+class TLazyResult
+{
+public:
+
+    using FResult = TResult<T, E>;
+    using FInitializer = TUniqueFunction<FResult()>;
+
+    UE_NONCOPYABLE(TLazyResult);
+
+    explicit TLazyResult(FInitializer&& InInitializer)
+        : Initializer(MoveTemp(InInitializer))
+    {
+    }
+
+    /** Evaluates the initializer on the first call, every call returns the same cached result */
+    const FResult& Get() const
+    {
+        if (LIKELY(bEvaluated.load(std::memory_order_acquire)))
+        {
+            return Outcome.GetValue();
+        }
+        return Evaluate();
+    }
+
+    /** The cached result, or nullptr if nothing has accessed the value yet */
+    const FResult* TryGet() const
+    {
+        return bEvaluated.load(std::memory_order_acquire) ? &Outcome.GetValue() : nullptr;
+    }
+
+    bool IsEvaluated() const { return bEvaluated.load(std::memory_order_acquire); }
+
+    bool IsOk() const { return Get().IsOk(); }
+    bool IsErr() const { return Get().IsErr(); }
+
+private:
+
+    const FResult& Evaluate() const
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (!bEvaluated.load(std::memory_order_relaxed))
+        {
+            // The lock is recursive, so an initializer reading its own value would otherwise recurse forever
+            if (bEvaluating)
+            {
+                UE_LOG(LogTemp, Fatal, TEXT("TLazyResult initializer accessed its own value"));
+            }
+
+            bEvaluating = true;
+            Outcome.Emplace(Initializer());
+            Initializer = nullptr;
+            bEvaluating = false;
+            bEvaluated.store(true, std::memory_order_release);
+        }
+        return Outcome.GetValue();
+    }
+
+    mutable FCriticalSection Lock;
+    mutable FInitializer Initializer;
+    mutable TOptional<FResult> Outcome;
+    mutable bool bEvaluating = false;
+    mutable std::atomic<bool> bEvaluated{false};
+};
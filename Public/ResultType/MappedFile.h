@@ -0,0 +1,62 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+#include "ResultType/IoError.h"
+#include "ResultType/Result.h"
+
+/** Expected access pattern, forwarded to madvise where the platform supports it */
+enum class EMappedAccessHint : uint8
+{
+    Normal,
+    Sequential,
+    Random,
+    WillNeed,
+    DontNeed,
+};
+
+class FMappedRegion;
+
+/**
+ * Maps Size bytes of the file starting at Offset, the rest of the file by default
+ * Views are limited to MAX_int32 bytes, larger files are mapped in windows.
+ */
+RESULTERRORHANDLINGTYPE_API TResult<FMappedRegion, FIoError> MapFile(const FString& Path, int64 Offset = 0, int64 Size = MAX_int64, EMappedAccessHint Hint = EMappedAccessHint::Normal);
+
+/**
+ * Read-only view of a memory-mapped file range
+ * Copies share the mapping, which is released when the last copy is destroyed or reset.
+ */
+class RESULTERRORHANDLINGTYPE_API FMappedRegion
+{
+public:
+
+    FMappedRegion() = default;
+
+    bool IsValid() const { return State.IsValid(); }
+
+    /** Zero-copy view of the mapped bytes, valid while this region or a copy of it is alive */
+    TArrayView<const uint8> GetView() const;
+
+    int32 Num() const { return GetView().Num(); }
+
+    /** Offset of the view within the file */
+    int64 GetFileOffset() const;
+
+    const FString& GetPath() const;
+
+    /** Hints the expected access pattern for a sub-range of the view, the whole view by default */
+    void Advise(EMappedAccessHint Hint, int64 Offset = 0, int64 Size = MAX_int64) const;
+
+    void Reset() { State.Reset(); }
+
+private:
+
+    struct FState;
+
+    friend TResult<FMappedRegion, FIoError> MapFile(const FString& Path, int64 Offset, int64 Size, EMappedAccessHint Hint);
+
+    TSharedPtr<FState, ESPMode::ThreadSafe> State;
+};
@@ -0,0 +1,205 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StringView.h"
+#include "ResultType/Result.h"
+
+#include <limits>
+#include <type_traits>
+
+enum class EParseErrorKind : uint8
+{
+    Empty,
+    InvalidCharacter,
+    Overflow,
+    UnexpectedEnd,
+};
+
+/** Parse failure, Offset is the index of the offending character in the parsed text */
+struct FParseError
+{
+    EParseErrorKind Kind = EParseErrorKind::Empty;
+    int32 Offset = 0;
+
+    FString GetErrorMessage() const;
+    int32 GetErrorCode() const { return static_cast<int32>(Kind); }
+
+    bool operator==(const FParseError& Other) const
+    {
+        return Kind == Other.Kind && Offset == Other.Offset;
+    }
+};
+
+namespace ResultHelpers
+{
+    /** Parses an unsigned run of decimal digits, Text must not contain a sign */
+    RESULTERRORHANDLINGTYPE_API TResult<uint64, FParseError> ParseDigits(FStringView Text, int32 BaseOffset);
+
+    RESULTERRORHANDLINGTYPE_API TResult<double, FParseError> ParseDouble(FStringView Text);
+
+    /**
+     * Smallest magnitude that rounds past the largest finite T, halfway between it and the next power of two
+     * Anything below rounds to a finite value, including the shortest round-trip text of the largest T.
+     */
+    template<typename T>
+    constexpr double NarrowingOverflowThreshold()
+    {
+        static_assert(sizeof(T) < sizeof(double), "Only types narrower than double can overflow when converted");
+        double NextPowerOfTwo = 1.0;
+        for (int32 Exponent = 0; Exponent < std::numeric_limits<T>::max_exponent; ++Exponent)
+        {
+            NextPowerOfTwo *= 2.0;
+        }
+
+        // Exact in double, which has more than enough mantissa bits for the sum
+        return (static_cast<double>(TNumericLimits<T>::Max()) + NextPowerOfTwo) / 2.0;
+    }
+
+    /** Calls Visitor(Field, FieldOffset) for every field split by Delimiter or line breaks, with surrounding blanks trimmed */
+    template<typename VisitorType>
+    TVoidResult<FParseError> ForEachField(FStringView Text, TCHAR Delimiter, VisitorType&& Visitor)
+    {
+        auto IsBlank = [](TCHAR Char) { return Char == TEXT(' ') || Char == TEXT('\t') || Char == TEXT('\r'); };
+
+        int32 FieldStart = 0;
+        for (int32 Index = 0; Index <= Text.Len(); ++Index)
+        {
+            if (Index < Text.Len() && Text[Index] != Delimiter && Text[Index] != TEXT('\n'))
+            {
+                continue;
+            }
+
+            int32 Begin = FieldStart;
+            int32 End = Index;
+            while (Begin < End && IsBlank(Text[Begin]))
+            {
+                ++Begin;
+            }
+            while (End > Begin && IsBlank(Text[End - 1]))
+            {
+                --End;
+            }
+
+            // Skip blank lines but keep empty fields between delimiters as errors
+            const bool bBlankLine = Begin == End && (Index == Text.Len() || Text[Index] == TEXT('\n')) && (FieldStart == 0 || Text[FieldStart - 1] == TEXT('\n'));
+            if (!bBlankLine)
+            {
+                TVoidResult<FParseError> FieldResult = Visitor(Text.Mid(Begin, End - Begin), Begin);
+                if (FieldResult.IsErr())
+                {
+                    return FieldResult;
+                }
+            }
+            FieldStart = Index + 1;
+        }
+        return TVoidResult<FParseError>(Ok, Unit);
+    }
+}
+
+/**
+ * Parses a decimal integer with an optional sign, the whole view must be consumed
+ * Digits are validated in a branch-free pass before being accumulated
+ */
+template<typename T>
+TResult<T, FParseError> ParseInt(FStringView Text)
+{
+    static_assert(std::is_integral_v<T>, "ParseInt requires an integral type");
+
+    if (Text.IsEmpty())
+    {
+        return TResult<T, FParseError>(ResultHelpers::Err, FParseError{EParseErrorKind::Empty, 0});
+    }
+
+    const bool bNegative = Text[0] == TEXT('-');
+    const int32 DigitsStart = (bNegative || Text[0] == TEXT('+')) ? 1 : 0;
+    if (bNegative && !std::is_signed_v<T>)
+    {
+        return TResult<T, FParseError>(ResultHelpers::Err, FParseError{EParseErrorKind::InvalidCharacter, 0});
+    }
+
+    TResult<uint64, FParseError> Magnitude = ResultHelpers::ParseDigits(Text.RightChop(DigitsStart), DigitsStart);
+    if (Magnitude.IsErr())
+    {
+        return TResult<T, FParseError>(ResultHelpers::Err, Magnitude.UnwrapErr());
+    }
+
+    const uint64 Value = Magnitude.Unwrap();
+    const uint64 Limit = bNegative
+        ? static_cast<uint64>(-(static_cast<int64>(TNumericLimits<T>::Min()) + 1)) + 1
+        : static_cast<uint64>(TNumericLimits<T>::Max());
+    if (Value > Limit)
+    {
+        return TResult<T, FParseError>(ResultHelpers::Err, FParseError{EParseErrorKind::Overflow, 0});
+    }
+
+    const T Result = bNegative ? static_cast<T>(0 - Value) : static_cast<T>(Value);
+    return TResult<T, FParseError>(ResultHelpers::Ok, Result);
+}
+
+/**
+ * Parses a decimal floating point number with optional fraction and exponent
+ * Short inputs take an exact fast path, longer ones fall back to the C runtime conversion
+ */
+template<typename T = double>
+TResult<T, FParseError> ParseFloat(FStringView Text)
+{
+    static_assert(std::is_floating_point_v<T>, "ParseFloat requires a floating point type");
+
+    TResult<double, FParseError> Parsed = ResultHelpers::ParseDouble(Text);
+    if (Parsed.IsErr())
+    {
+        return TResult<T, FParseError>(ResultHelpers::Err, Parsed.UnwrapErr());
+    }
+
+    // Checked on the double, converting a double that rounds outside the range of T is undefined
+    const double Value = Parsed.Unwrap();
+    if constexpr (sizeof(T) < sizeof(double))
+    {
+        if (FMath::Abs(Value) >= ResultHelpers::NarrowingOverflowThreshold<T>())
+        {
+            // The whole number is out of range, so the error points at the start of its token
+            return TResult<T, FParseError>(ResultHelpers::Err, FParseError{EParseErrorKind::Overflow, 0});
+        }
+    }
+    return TResult<T, FParseError>(ResultHelpers::Ok, static_cast<T>(Value));
+}
+
+/**
+ * Batch parsing of delimited columns (CSV rows, DataTable text)
+ * Values are appended to Out, the error offset is relative to Text
+ */
+template<typename T>
+TVoidResult<FParseError> ParseIntColumn(FStringView Text, TCHAR Delimiter, TArray<T>& Out)
+{
+    return ResultHelpers::ForEachField(Text, Delimiter, [&Out](FStringView Field, int32 FieldOffset)
+    {
+        TResult<T, FParseError> Value = ParseInt<T>(Field);
+        if (Value.IsErr())
+        {
+            FParseError Error = Value.UnwrapErr();
+            Error.Offset += FieldOffset;
+            return TVoidResult<FParseError>(ResultHelpers::Err, Error);
+        }
+        Out.Add(Value.Unwrap());
+        return TVoidResult<FParseError>(ResultHelpers::Ok, ResultHelpers::Unit);
+    });
+}
+
+template<typename T>
+TVoidResult<FParseError> ParseFloatColumn(FStringView Text, TCHAR Delimiter, TArray<T>& Out)
+{
+    return ResultHelpers::ForEachField(Text, Delimiter, [&Out](FStringView Field, int32 FieldOffset)
+    {
+        TResult<T, FParseError> Value = ParseFloat<T>(Field);
+        if (Value.IsErr())
+        {
+            FParseError Error = Value.UnwrapErr();
+            Error.Offset += FieldOffset;
+            return TVoidResult<FParseError>(ResultHelpers::Err, Error);
+        }
+        Out.Add(Value.Unwrap());
+        return TVoidResult<FParseError>(ResultHelpers::Ok, ResultHelpers::Unit);
+    });
+}
@@ -0,0 +1,184 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Queue.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/Crc.h"
+#include "Misc/Optional.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "ResultType/IoError.h"
+#include "ResultType/Result.h"
+
+#include <atomic>
+
+class FEvent;
+class IFileHandle;
+
+enum class EOutcomeMode : uint8
+{
+    /** Calls run and their outcomes are written to the stream */
+    Record,
+    /** Calls are skipped and the recorded outcomes are returned */
+    Replay,
+};
+
+/** Named boundary whose outcomes are recorded, declare it static so the name is hashed once */
+struct FOutcomeChannel
+{
+    explicit FOutcomeChannel(const TCHAR* InName)
+        : Name(InName)
+        , Id(FCrc::StrCrc32(InName))
+    {
+    }
+
+    const TCHAR* Name;
+    uint32 Id;
+};
+
+/**
+ * Records the outcomes of fallible boundaries such as I/O and clock checks, and replays them in the same order
+ * Recording serializes the Ok value or the error with operator<< on the calling thread and queues it, a background
+ * thread frames and writes the queued outcomes in batches every few milliseconds. Outcomes are replayed per channel
+ * in recording order, so a channel should only be called from one thread or in a deterministic order.
+ * A replay that runs out of outcomes executes the call.
+ */
+class RESULTERRORHANDLINGTYPE_API FOutcomeRecorder
+{
+public:
+
+    using FRecorderPtr = TSharedPtr<FOutcomeRecorder, ESPMode::ThreadSafe>;
+
+    UE_NONCOPYABLE(FOutcomeRecorder);
+
+    static TResult<FRecorderPtr, FIoError> StartRecording(const FString& Path);
+    static TResult<FRecorderPtr, FIoError> StartReplay(const FString& Path);
+
+    /** Writes every pending outcome and closes the stream */
+    ~FOutcomeRecorder();
+
+    template<typename F>
+    TDecay_T<TInvokeResult_T<F>> Call(const FOutcomeChannel& Channel, F&& Func)
+    {
+        using FResultType = TDecay_T<TInvokeResult_T<F>>;
+        using T = typename FResultType::OkValueType;
+        using E = typename FResultType::ErrValueType;
+
+        if (Mode == EOutcomeMode::Replay)
+        {
+            TOptional<FResultType> Replayed = ReplayNext<T, E>(Channel);
+            if (Replayed.IsSet())
+            {
+                return MoveTemp(Replayed.GetValue());
+            }
+            return Func();
+        }
+
+        FResultType Result = Func();
+        TArray<uint8> Payload;
+        FMemoryWriter PayloadWriter(Payload);
+        if (Result.IsOk())
+        {
+            PayloadWriter << const_cast<T&>(Result.Unwrap());
+        }
+        else
+        {
+            PayloadWriter << const_cast<E&>(Result.UnwrapErr());
+        }
+        Submit(Channel, Result.IsOk(), MoveTemp(Payload));
+        return Result;
+    }
+
+    EOutcomeMode GetMode() const { return Mode; }
+
+    /** Waits until every outcome recorded before the call is written, reports the first write failure */
+    TVoidResult<FIoError> Flush();
+
+    /** Replayed calls that found no matching outcome and ran instead */
+    int32 GetReplayMissCount() const { return ReplayMisses.load(); }
+
+private:
+
+    struct FPendingOutcome
+    {
+        uint32 ChannelId = 0;
+        bool bIsOk = false;
+        TArray<uint8> Payload;
+    };
+
+    struct FReplayOutcome
+    {
+        bool bIsOk = false;
+        int32 Offset = 0;
+        int32 Size = 0;
+    };
+
+    struct FReplayChannel
+    {
+        uint32 Id = 0;
+        int32 Next = 0;
+        TArray<FReplayOutcome> Outcomes;
+    };
+
+    FOutcomeRecorder(EOutcomeMode InMode, const FString& InPath);
+
+    template<typename T, typename E>
+    TOptional<TResult<T, E>> ReplayNext(const FOutcomeChannel& Channel)
+    {
+        TOptional<FReplayOutcome> Outcome = TakeReplayOutcome(Channel);
+        if (Outcome.IsSet())
+        {
+            FMemoryReaderView Reader(TArrayView<const uint8>(ReplayBytes.GetData() + Outcome->Offset, Outcome->Size));
+            if (Outcome->bIsOk)
+            {
+                T Value;
+                Reader << Value;
+                if (!Reader.IsError())
+                {
+                    return TResult<T, E>(ResultHelpers::Ok, MoveTemp(Value));
+                }
+            }
+            else
+            {
+                E Error;
+                Reader << Error;
+                if (!Reader.IsError())
+                {
+                    return TResult<T, E>(ResultHelpers::Err, MoveTemp(Error));
+                }
+            }
+        }
+
+        ++ReplayMisses;
+        return TOptional<TResult<T, E>>();
+    }
+
+    TOptional<FReplayOutcome> TakeReplayOutcome(const FOutcomeChannel& Channel);
+    TVoidResult<FIoError> ParseReplay();
+
+    void Submit(const FOutcomeChannel& Channel, bool bIsOk, TArray<uint8>&& Payload);
+    void RunWriter();
+
+    const EOutcomeMode Mode;
+    const FString Path;
+
+    // Recording
+    IFileHandle* Handle = nullptr;
+    TQueue<FPendingOutcome, EQueueMode::Mpsc> Pending;
+    FEvent* WorkAvailable = nullptr;
+    TFuture<void> WriterTask;
+    std::atomic<uint64> SubmittedCount{0};
+    std::atomic<uint64> WrittenCount{0};
+    std::atomic<bool> bStopping{false};
+    std::atomic<bool> bWriteFailed{false};
+    std::atomic<int64> FailedOffset{0};
+
+    // Replay
+    FCriticalSection ReplayLock;
+    TArray<uint8> ReplayBytes;
+    TArray<FReplayChannel> ReplayChannels;
+    std::atomic<int32> ReplayMisses{0};
+};
@@ -0,0 +1,355 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StringView.h"
+#include "Templates/Tuple.h"
+#include "ResultType/NumberParsing.h"
+#include "ResultType/Result.h"
+
+#include <type_traits>
+
+/** Result of a parser: the parsed value and the remaining input */
+template<typename V>
+using TParseResult = TResult<TTuple<V, FStringView>, FParseError>;
+
+/**
+ * Parser combinators over FStringView
+ * A parser is any callable taking an FStringView and returning a TParseResult. Combinators are plain
+ * structs holding their sub-parsers by value, so composition is resolved at compile time and never allocates.
+ * Error offsets are relative to the input given to the outermost parser.
+ */
+namespace ResultParsers
+{
+    template<typename ParserType>
+    using TParserValue_T = TDecay_T<decltype(DeclVal<const typename TInvokeResult_T<const ParserType&, FStringView>::OkValueType&>().template Get<0>())>;
+
+    template<typename V>
+    TParseResult<TDecay_T<V>> MakeSuccess(V&& Value, FStringView Rest)
+    {
+        return TParseResult<TDecay_T<V>>(ResultHelpers::Ok, TTuple<TDecay_T<V>, FStringView>(Forward<V>(Value), Rest));
+    }
+
+    template<typename V>
+    TParseResult<V> MakeFailure(EParseErrorKind Kind, int32 Offset)
+    {
+        return TParseResult<V>(ResultHelpers::Err, FParseError{Kind, Offset});
+    }
+
+    template<typename V>
+    TParseResult<V> ShiftError(const FParseError& Error, int32 Consumed)
+    {
+        return TParseResult<V>(ResultHelpers::Err, FParseError{Error.Kind, Error.Offset + Consumed});
+    }
+
+    FORCEINLINE int32 ConsumedBetween(FStringView Start, FStringView Rest)
+    {
+        return static_cast<int32>(Rest.GetData() - Start.GetData());
+    }
+
+    // Primitive parsers
+    struct FLiteral
+    {
+        FStringView Text;
+
+        TParseResult<FStringView> operator()(FStringView Input) const
+        {
+            for (int32 Index = 0; Index < Text.Len(); ++Index)
+            {
+                if (Index >= Input.Len())
+                {
+                    return MakeFailure<FStringView>(EParseErrorKind::UnexpectedEnd, Index);
+                }
+                if (Input[Index] != Text[Index])
+                {
+                    return MakeFailure<FStringView>(EParseErrorKind::InvalidCharacter, Index);
+                }
+            }
+            return MakeSuccess(Input.Left(Text.Len()), Input.RightChop(Text.Len()));
+        }
+    };
+
+    template<typename PredicateType>
+    struct TCharIf
+    {
+        PredicateType Predicate;
+
+        TParseResult<TCHAR> operator()(FStringView Input) const
+        {
+            if (Input.IsEmpty())
+            {
+                return MakeFailure<TCHAR>(EParseErrorKind::UnexpectedEnd, 0);
+            }
+            if (!Predicate(Input[0]))
+            {
+                return MakeFailure<TCHAR>(EParseErrorKind::InvalidCharacter, 0);
+            }
+            return MakeSuccess(TCHAR(Input[0]), Input.RightChop(1));
+        }
+    };
+
+    /** Parses one decimal digit and yields its value */
+    struct FDigit
+    {
+        TParseResult<int32> operator()(FStringView Input) const
+        {
+            if (Input.IsEmpty())
+            {
+                return MakeFailure<int32>(EParseErrorKind::UnexpectedEnd, 0);
+            }
+            if (Input[0] < TEXT('0') || Input[0] > TEXT('9'))
+            {
+                return MakeFailure<int32>(EParseErrorKind::InvalidCharacter, 0);
+            }
+            return MakeSuccess(static_cast<int32>(Input[0] - TEXT('0')), Input.RightChop(1));
+        }
+    };
+
+    // Combinators
+    template<typename... ParserTypes>
+    struct TSequence
+    {
+        using FValueType = TTuple<TParserValue_T<ParserTypes>...>;
+
+        TTuple<ParserTypes...> Parsers;
+
+        TParseResult<FValueType> operator()(FStringView Input) const
+        {
+            return Step<0>(Input, Input);
+        }
+
+    private:
+
+        template<uint32 Index, typename... ValueTypes>
+        TParseResult<FValueType> Step(FStringView Start, FStringView Input, ValueTypes&&... Values) const
+        {
+            if constexpr (Index == sizeof...(ParserTypes))
+            {
+                return MakeSuccess(FValueType(Forward<ValueTypes>(Values)...), Input);
+            }
+            else
+            {
+                auto Result = Parsers.template Get<Index>()(Input);
+                if (Result.IsErr())
+                {
+                    return ShiftError<FValueType>(Result.UnwrapErr(), ConsumedBetween(Start, Input));
+                }
+                const auto& Parsed = Result.Unwrap();
+                return Step<Index + 1>(Start, Parsed.template Get<1>(), Forward<ValueTypes>(Values)..., Parsed.template Get<0>());
+            }
+        }
+    };
+
+    /** Tries each alternative in order, on failure reports the error that got furthest */
+    template<typename FirstParserType, typename... OtherParserTypes>
+    struct TChoice
+    {
+        using FValueType = TParserValue_T<FirstParserType>;
+        static_assert((std::is_same_v<FValueType, TParserValue_T<OtherParserTypes>> && ...), "Choice alternatives must produce the same value type");
+
+        TTuple<FirstParserType, OtherParserTypes...> Parsers;
+
+        TParseResult<FValueType> operator()(FStringView Input) const
+        {
+            return Step<0>(Input, FParseError{EParseErrorKind::Empty, -1});
+        }
+
+    private:
+
+        template<uint32 Index>
+        TParseResult<FValueType> Step(FStringView Input, const FParseError& Furthest) const
+        {
+            if constexpr (Index == 1 + sizeof...(OtherParserTypes))
+            {
+                return TParseResult<FValueType>(ResultHelpers::Err, Furthest);
+            }
+            else
+            {
+                TParseResult<FValueType> Result = Parsers.template Get<Index>()(Input);
+                if (Result.IsOk())
+                {
+                    return Result;
+                }
+                const FParseError& Error = Result.UnwrapErr();
+                return Step<Index + 1>(Input, Error.Offset > Furthest.Offset ? Error : Furthest);
+            }
+        }
+    };
+
+    /** Applies the parser repeatedly and folds every value into an accumulator */
+    template<typename ParserType, typename AccumulatorType, typename FoldType>
+    struct TManyFold
+    {
+        ParserType Parser;
+        AccumulatorType Initial;
+        FoldType Fold;
+        int32 MinCount = 0;
+
+        TParseResult<AccumulatorType> operator()(FStringView Input) const
+        {
+            AccumulatorType Accumulator = Initial;
+            FStringView Rest = Input;
+            int32 Count = 0;
+            while (true)
+            {
+                auto Result = Parser(Rest);
+                if (Result.IsErr())
+                {
+                    if (Count < MinCount)
+                    {
+                        return ShiftError<AccumulatorType>(Result.UnwrapErr(), ConsumedBetween(Input, Rest));
+                    }
+                    break;
+                }
+
+                const auto& Parsed = Result.Unwrap();
+                Accumulator = Fold(MoveTemp(Accumulator), Parsed.template Get<0>());
+                ++Count;
+
+                // A parser that consumes nothing would match forever
+                if (Parsed.template Get<1>().GetData() == Rest.GetData())
+                {
+                    break;
+                }
+                Rest = Parsed.template Get<1>();
+            }
+            return MakeSuccess(MoveTemp(Accumulator), Rest);
+        }
+    };
+
+    /** Applies the parser repeatedly and yields the matched span of input */
+    template<typename ParserType>
+    struct TMany
+    {
+        ParserType Parser;
+        int32 MinCount = 0;
+
+        TParseResult<FStringView> operator()(FStringView Input) const
+        {
+            auto CountOnly = [](int32 Count, const TParserValue_T<ParserType>&) { return Count + 1; };
+            TManyFold<const ParserType&, int32, decltype(CountOnly)> Counter{Parser, 0, CountOnly, MinCount};
+
+            auto Result = Counter(Input);
+            if (Result.IsErr())
+            {
+                return TParseResult<FStringView>(ResultHelpers::Err, Result.UnwrapErr());
+            }
+            const FStringView Rest = Result.Unwrap().template Get<1>();
+            return MakeSuccess(Input.Left(ConsumedBetween(Input, Rest)), Rest);
+        }
+    };
+
+    template<typename ParserType, typename FunctionType>
+    struct TMapParser
+    {
+        using FValueType = TDecay_T<TInvokeResult_T<const FunctionType&, const TParserValue_T<ParserType>&>>;
+
+        ParserType Parser;
+        FunctionType Function;
+
+        TParseResult<FValueType> operator()(FStringView Input) const
+        {
+            auto Result = Parser(Input);
+            if (Result.IsErr())
+            {
+                return TParseResult<FValueType>(ResultHelpers::Err, Result.UnwrapErr());
+            }
+            const auto& Parsed = Result.Unwrap();
+            return MakeSuccess(Function(Parsed.template Get<0>()), Parsed.template Get<1>());
+        }
+    };
+
+    /** Never fails, yields an unset optional when the parser does not match */
+    template<typename ParserType>
+    struct TOptionalParser
+    {
+        using FValueType = TOptional<TParserValue_T<ParserType>>;
+
+        ParserType Parser;
+
+        TParseResult<FValueType> operator()(FStringView Input) const
+        {
+            auto Result = Parser(Input);
+            if (Result.IsErr())
+            {
+                return MakeSuccess(FValueType(), Input);
+            }
+            const auto& Parsed = Result.Unwrap();
+            return MakeSuccess(FValueType(Parsed.template Get<0>()), Parsed.template Get<1>());
+        }
+    };
+
+    // Factory functions
+    inline FLiteral Literal(FStringView Text)
+    {
+        return FLiteral{Text};
+    }
+
+    inline FDigit Digit()
+    {
+        return FDigit{};
+    }
+
+    template<typename PredicateType>
+    TCharIf<TDecay_T<PredicateType>> CharIf(PredicateType&& Predicate)
+    {
+        return TCharIf<TDecay_T<PredicateType>>{Forward<PredicateType>(Predicate)};
+    }
+
+    template<typename... ParserTypes>
+    TSequence<TDecay_T<ParserTypes>...> Sequence(ParserTypes&&... Parsers)
+    {
+        return TSequence<TDecay_T<ParserTypes>...>{TTuple<TDecay_T<ParserTypes>...>(Forward<ParserTypes>(Parsers)...)};
+    }
+
+    template<typename... ParserTypes>
+    TChoice<TDecay_T<ParserTypes>...> Choice(ParserTypes&&... Parsers)
+    {
+        return TChoice<TDecay_T<ParserTypes>...>{TTuple<TDecay_T<ParserTypes>...>(Forward<ParserTypes>(Parsers)...)};
+    }
+
+    template<typename ParserType>
+    TMany<TDecay_T<ParserType>> Many(ParserType&& Parser, int32 MinCount = 0)
+    {
+        return TMany<TDecay_T<ParserType>>{Forward<ParserType>(Parser), MinCount};
+    }
+
+    template<typename ParserType, typename AccumulatorType, typename FoldType>
+    TManyFold<TDecay_T<ParserType>, AccumulatorType, TDecay_T<FoldType>> ManyFold(ParserType&& Parser, AccumulatorType Initial, FoldType&& Fold, int32 MinCount = 0)
+    {
+        return TManyFold<TDecay_T<ParserType>, AccumulatorType, TDecay_T<FoldType>>{Forward<ParserType>(Parser), MoveTemp(Initial), Forward<FoldType>(Fold), MinCount};
+    }
+
+    template<typename ParserType, typename FunctionType>
+    TMapParser<TDecay_T<ParserType>, TDecay_T<FunctionType>> Map(ParserType&& Parser, FunctionType&& Function)
+    {
+        return TMapParser<TDecay_T<ParserType>, TDecay_T<FunctionType>>{Forward<ParserType>(Parser), Forward<FunctionType>(Function)};
+    }
+
+    template<typename ParserType>
+    TOptionalParser<TDecay_T<ParserType>> Optional(ParserType&& Parser)
+    {
+        return TOptionalParser<TDecay_T<ParserType>>{Forward<ParserType>(Parser)};
+    }
+
+    /** Runs the parser and requires it to consume the whole input */
+    template<typename ParserType>
+    TResult<TParserValue_T<ParserType>, FParseError> ParseAll(const ParserType& Parser, FStringView Input)
+    {
+        using FValueType = TParserValue_T<ParserType>;
+
+        auto Result = Parser(Input);
+        if (Result.IsErr())
+        {
+            return TResult<FValueType, FParseError>(ResultHelpers::Err, Result.UnwrapErr());
+        }
+
+        const auto& Parsed = Result.Unwrap();
+        if (!Parsed.template Get<1>().IsEmpty())
+        {
+            return TResult<FValueType, FParseError>(ResultHelpers::Err, FParseError{EParseErrorKind::InvalidCharacter, ConsumedBetween(Input, Parsed.template Get<1>())});
+        }
+        return TResult<FValueType, FParseError>(ResultHelpers::Ok, Parsed.template Get<0>());
+    }
+}
@@ -0,0 +1,228 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Optional.h"
+#include "Templates/Function.h"
+#include "ResultType/Result.h"
+
+#include <atomic>
+
+template<typename T>
+class TResultPool;
+
+/** Acquisition failure, with the pool state at the time of the request */
+struct FPoolError
+{
+    int32 Capacity = 0;
+    int32 InUse = 0;
+
+    FString GetErrorMessage() const
+    {
+        return FString::Printf(TEXT("Pool exhausted: %d of %d objects in use"), InUse, Capacity);
+    }
+
+    bool operator==(const FPoolError& Other) const
+    {
+        return Capacity == Other.Capacity && InUse == Other.InUse;
+    }
+};
+
+/** Move-only handle to a pooled object, the object goes back to its pool when the handle is reset or destroyed */
+template<typename T>
+class TPooledRef
+{
+public:
+
+    TPooledRef() = default;
+
+    TPooledRef(TPooledRef&& Other)
+        : Pool(Other.Pool)
+        , Index(Other.Index)
+    {
+        Other.Pool = nullptr;
+        Other.Index = INDEX_NONE;
+    }
+
+    TPooledRef& operator=(TPooledRef&& Other)
+    {
+        if (this != &Other)
+        {
+            Reset();
+            Pool = Other.Pool;
+            Index = Other.Index;
+            Other.Pool = nullptr;
+            Other.Index = INDEX_NONE;
+        }
+        return *this;
+    }
+
+    TPooledRef(const TPooledRef&) = delete;
+    TPooledRef& operator=(const TPooledRef&) = delete;
+
+    ~TPooledRef()
+    {
+        Reset();
+    }
+
+    bool IsValid() const { return Pool != nullptr; }
+
+    T& Get() const { return Pool->GetObject(Index); }
+    T& operator*() const { return Get(); }
+    T* operator->() const { return &Get(); }
+
+    /** Returns the object to the pool early */
+    void Reset()
+    {
+        if (Pool != nullptr)
+        {
+            Pool->Release(Index);
+            Pool = nullptr;
+            Index = INDEX_NONE;
+        }
+    }
+
+private:
+
+    friend class TResultPool<T>;
+
+    TPooledRef(TResultPool<T>* InPool, int32 InIndex)
+        : Pool(InPool)
+        , Index(InIndex)
+    {
+    }
+
+    TResultPool<T>* Pool = nullptr;
+    int32 Index = INDEX_NONE;
+};
+
+/**
+ * Fixed-capacity pool of reusable objects behind a lock-free free list
+ * Objects are built by the factory the first time their slot is handed out and are reused as-is afterwards.
+ * The factory may run on several threads at once. The pool must outlive every handle it gives out.
+ */
+template<typename T>
+class TResultPool
+{
+public:
+
+    using FFactory = TUniqueFunction<T()>;
+
+    UE_NONCOPYABLE(TResultPool);
+
+    explicit TResultPool(int32 InCapacity, FFactory&& InFactory = nullptr)
+        : Capacity(FMath::Max(InCapacity, 1))
+        , Slots(new FSlot[Capacity])
+        , Factory(MoveTemp(InFactory))
+    {
+        // Chain every slot into the free list, stored as index + 1 so zero means empty
+        for (int32 Index = 0; Index < Capacity; ++Index)
+        {
+            Slots[Index].NextFree.store(Index + 1 < Capacity ? Index + 2 : 0, std::memory_order_relaxed);
+        }
+        FreeHead.store(1, std::memory_order_relaxed);
+    }
+
+    ~TResultPool()
+    {
+        ensureMsgf(InUse.load() == 0, TEXT("TResultPool destroyed with %d objects in use"), InUse.load());
+        delete[] Slots;
+    }
+
+    TResult<TPooledRef<T>, FPoolError> TryAcquire()
+    {
+        const int32 Index = PopFree();
+        if (Index == INDEX_NONE)
+        {
+            return TResult<TPooledRef<T>, FPoolError>(ResultHelpers::Err, FPoolError{Capacity, InUse.load(std::memory_order_relaxed)});
+        }
+
+        InUse.fetch_add(1, std::memory_order_relaxed);
+        FSlot& Slot = Slots[Index];
+        if (!Slot.Object.IsSet())
+        {
+            if (Factory)
+            {
+                Slot.Object.Emplace(Factory());
+            }
+            else
+            {
+                Slot.Object.Emplace();
+            }
+        }
+        return TResult<TPooledRef<T>, FPoolError>(ResultHelpers::Ok, TPooledRef<T>(this, Index));
+    }
+
+    int32 GetCapacity() const { return Capacity; }
+    int32 GetNumInUse() const { return InUse.load(std::memory_order_relaxed); }
+
+private:
+
+    friend class TPooledRef<T>;
+
+    struct FSlot
+    {
+        TOptional<T> Object;
+        std::atomic<uint32> NextFree{0};
+    };
+
+    T& GetObject(int32 Index) const
+    {
+        return Slots[Index].Object.GetValue();
+    }
+
+    void Release(int32 Index)
+    {
+        InUse.fetch_sub(1, std::memory_order_relaxed);
+        PushFree(Index);
+    }
+
+    // The head packs a generation counter above the slot link, so a slot popped and pushed back between a load
+    // and the compare and swap does not let a stale next link through
+    int32 PopFree()
+    {
+        uint64 Head = FreeHead.load(std::memory_order_acquire);
+        while (true)
+        {
+            const uint32 Link = static_cast<uint32>(Head);
+            if (Link == 0)
+            {
+                return INDEX_NONE;
+            }
+
+            const uint64 Next = ((Head >> 32) + 1) << 32 | Slots[Link - 1].NextFree.load(std::memory_order_relaxed);
+            if (FreeHead.compare_exchange_weak(Head, Next, std::memory_order_acquire, std::memory_order_acquire))
+            {
+                return static_cast<int32>(Link - 1);
+            }
+        }
+    }
+
+    void PushFree(int32 Index)
+    {
+        uint64 Head = FreeHead.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slots[Index].NextFree.store(static_cast<uint32>(Head), std::memory_order_relaxed);
+            const uint64 Next = ((Head >> 32) + 1) << 32 | static_cast<uint32>(Index + 1);
+            if (FreeHead.compare_exchange_weak(Head, Next, std::memory_order_release, std::memory_order_relaxed))
+            {
+                return;
+            }
+        }
+    }
+
+    const int32 Capacity;
+    FSlot* Slots;
+    FFactory Factory;
+
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> FreeHead{0};
+    std::atomic<int32> InUse{0};
+};
+
+template<typename T>
+TResult<TPooledRef<T>, FPoolError> TryAcquire(TResultPool<T>& Pool)
+{
+    return Pool.TryAcquire();
+}
@@ -22,27 +22,78 @@ namespace ResultHelpers
     constexpr OkTag Ok{};
     constexpr ErrTag Err{};
 
+    // Ok payload for results that carry no value
+    struct FUnit
+    {
+        bool operator==(const FUnit&) const { return true; }
+        bool operator!=(const FUnit&) const { return false; }
+    };
+
+    constexpr FUnit Unit{};
+
+    // Picks a value without a branch, integers and floats are blended through a mask so the compiler cannot emit a jump
+    template<typename T>
+    FORCEINLINE T SelectValue(bool bCondition, const T& IfTrue, const T& IfFalse)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "SelectValue requires a trivially copyable type");
+
+        if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+        {
+            using FBits = std::make_unsigned_t<T>;
+            const FBits Mask = static_cast<FBits>(FBits(0) - static_cast<FBits>(bCondition));
+            return static_cast<T>((static_cast<FBits>(IfTrue) & Mask) | (static_cast<FBits>(IfFalse) & static_cast<FBits>(~Mask)));
+        }
+        else if constexpr (std::is_floating_point_v<T> && (sizeof(T) == 4 || sizeof(T) == 8))
+        {
+            using FBits = std::conditional_t<sizeof(T) == 4, uint32, uint64>;
+            FBits TrueBits;
+            FBits FalseBits;
+            FMemory::Memcpy(&TrueBits, &IfTrue, sizeof(T));
+            FMemory::Memcpy(&FalseBits, &IfFalse, sizeof(T));
+            const FBits Selected = SelectValue(bCondition, TrueBits, FalseBits);
+            T Result;
+            FMemory::Memcpy(&Result, &Selected, sizeof(T));
+            return Result;
+        }
+        else
+        {
+            return bCondition ? IfTrue : IfFalse;
+        }
+    }
+
     template<typename T, typename E>
     struct FOkOrErrValue
     {
-        FOkOrErrValue() = default;
+        // Only the select-based members read the inactive payload and they require trivially copyable payloads,
+        // so only those are zeroed and every other payload is left to its default constructor
+        FOkOrErrValue()
+        {
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                OKValue = T();
+            }
+            if constexpr (std::is_trivially_copyable_v<E>)
+            {
+                ERRValue = E();
+            }
+        }
         
-        FOkOrErrValue(OkTag, const T& Value)
+        FOkOrErrValue(OkTag, const T& Value) : FOkOrErrValue()
         {
             SetOkValue(Value);
         }
         
-        FOkOrErrValue(OkTag, T&& Value)
+        FOkOrErrValue(OkTag, T&& Value) : FOkOrErrValue()
         {
             SetOkValue(MoveTemp(Value));
         }
 
-        FOkOrErrValue(ErrTag, const E& Error)
+        FOkOrErrValue(ErrTag, const E& Error) : FOkOrErrValue()
         {
             SetErrValue(Error);
         }
 
-        FOkOrErrValue(ErrTag, E&& Error)
+        FOkOrErrValue(ErrTag, E&& Error) : FOkOrErrValue()
         {
             SetErrValue(MoveTemp(Error));
         }
@@ -67,6 +118,16 @@ namespace ResultHelpers
             return ERRValue;
         }
 
+        T&& TakeOkValue()
+        {
+            return MoveTemp(OKValue);
+        }
+
+        E&& TakeErrValue()
+        {
+            return MoveTemp(ERRValue);
+        }
+
         void SetOkValue(const T& Value)
         {
             OKValue = Value;
@@ -102,11 +163,89 @@ namespace ResultHelpers
         T OKValue;
         E ERRValue;
     };
+
+    // Reference results store a pointer to the referenced value and never copy it
+    template<typename T, typename E>
+    struct FOkOrErrValue<T&, E>
+    {
+        FOkOrErrValue() = default;
+
+        FOkOrErrValue(OkTag, T& Value)
+        {
+            SetOkValue(Value);
+        }
+
+        FOkOrErrValue(ErrTag, const E& Error)
+        {
+            SetErrValue(Error);
+        }
+
+        FOkOrErrValue(ErrTag, E&& Error)
+        {
+            SetErrValue(MoveTemp(Error));
+        }
+
+        T& GetOkValue() const
+        {
+            return *OKValue;
+        }
+
+        E& GetErrValue()
+        {
+            return ERRValue;
+        }
+
+        const E& GetErrValue() const
+        {
+            return ERRValue;
+        }
+
+        T& TakeOkValue() const
+        {
+            return *OKValue;
+        }
+
+        E&& TakeErrValue()
+        {
+            return MoveTemp(ERRValue);
+        }
+
+        void SetOkValue(T& Value)
+        {
+            OKValue = &Value;
+        }
+
+        void SetErrValue(const E& Err)
+        {
+            ERRValue = Err;
+        }
+
+        void SetErrValue(E&& Err)
+        {
+            ERRValue = MoveTemp(Err);
+        }
+
+        void ResetOk()
+        {
+            OKValue = nullptr;
+        }
+
+        void ResetErr()
+        {
+            ERRValue = E();
+        }
+
+    private:
+
+        T* OKValue = nullptr;
+        E ERRValue;
+    };
 }
 
 /**
  * A C++ implementation similar to Rust's Result<T, E> for Unreal Engine
  * Represents either a successful value (Ok) or an error (Err)
+ * T may be a reference, in which case the result refers to the value instead of holding a copy
  */
 template<typename T, typename E>
 class RESULTERRORHANDLINGTYPE_API TResult
@@ -119,6 +258,16 @@ private:
 #define OK_VALUE OkOrErrValue.GetOkValue()
 #define ERR_VALUE OkOrErrValue.GetErrValue()
 
+    template<typename, typename>
+    friend class TResult;
+
+    // Stores the active payload and zeroes the other one without a branch, used by the select-based members
+    TResult(bool bInIsOk, const T& Value, const E& Error) : bIsOk(bInIsOk)
+    {
+        OkOrErrValue.SetOkValue(ResultHelpers::SelectValue(bInIsOk, Value, T()));
+        OkOrErrValue.SetErrValue(ResultHelpers::SelectValue(bInIsOk, E(), Error));
+    }
+
 public:
 
     using OkValueType = T;
@@ -126,7 +275,7 @@ public:
     
     // Constructors
     TResult(const ResultHelpers::OkTag& InTag, const T& Value) : bIsOk(true), OkOrErrValue(InTag, Value) {}
-    TResult(const ResultHelpers::OkTag& InTag, T&& Value) : bIsOk(true), OkOrErrValue(InTag, MoveTemp(Value)) {}
+    TResult(const ResultHelpers::OkTag& InTag, TRemoveReference_T<T>&& Value) : bIsOk(true), OkOrErrValue(InTag, MoveTemp(Value)) {}
     
     TResult(const ResultHelpers::ErrTag& InTag, const E& Error) : bIsOk(false), OkOrErrValue(InTag, Error) {}
     TResult(const ResultHelpers::ErrTag& InTag, E&& Error) : bIsOk(false), OkOrErrValue(InTag, MoveTemp(Error)) {}
@@ -149,12 +298,12 @@ public:
     {
         if (bIsOk)
         {
-            OkOrErrValue.SetOkValue(Other.OkOrErrValue.GetOkValue());
+            OkOrErrValue.SetOkValue(Other.OkOrErrValue.TakeOkValue());
             Other.OkOrErrValue.ResetOk();
         }
         else
         {
-            OkOrErrValue.SetErrValue(Other.OkOrErrValue.GetErrValue());
+            OkOrErrValue.SetErrValue(Other.OkOrErrValue.TakeErrValue());
             Other.OkOrErrValue.ResetErr();
         }
     }
@@ -215,6 +364,16 @@ public:
         return OK_VALUE;
     }
 
+    /** Moves the Ok value out, for move-only payloads such as pooled handles */
+    T MoveUnwrap()
+    {
+        if (!bIsOk)
+        {
+            UE_LOG(LogTemp, Fatal, TEXT("Called MoveUnwrap on an Err Result"));
+        }
+        return OkOrErrValue.TakeOkValue();
+    }
+
     T UnwrapOr(const T& DefaultValue) const
     {
         return bIsOk ? OK_VALUE : DefaultValue;
@@ -226,6 +385,12 @@ public:
         return bIsOk ? OK_VALUE : Func(ERR_VALUE);
     }
 
+    /** Branch-free UnwrapOr for trivially copyable values, faster than UnwrapOr when Ok and Err are equally likely */
+    T UnwrapOrSelect(const T& DefaultValue) const
+    {
+        return ResultHelpers::SelectValue(bIsOk, OK_VALUE, DefaultValue);
+    }
+
     const E& ExpectErr(const TCHAR* Message) const
     {
         if (bIsOk)
@@ -258,6 +423,20 @@ public:
         }
     }
 
+    /**
+     * Branch-free Map for trivially copyable payloads
+     * Func is also called with T{} for an Err result and its return value is discarded. It must be cheap, free of
+     * side effects and defined for T{}: an integer division or an array index taking the value has to guard it.
+     */
+    template<typename F>
+    TResult<TInvokeResult_T<F, T>, E> MapSelect(F&& Func) const
+    {
+        using U = TInvokeResult_T<F, T>;
+        static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_copyable_v<U> && std::is_trivially_copyable_v<E>,
+            "MapSelect requires trivially copyable payloads");
+        return TResult<U, E>(bIsOk, Func(OK_VALUE), ERR_VALUE);
+    }
+
     template<typename F>
     TResult<T, TInvokeResult_T<F, E>> MapErr(F&& Func) const
     {
@@ -355,6 +534,36 @@ public:
     }
 };
 
+namespace ResultHelpers
+{
+    // Reference payloads are stored as pointers, which can always be copied bitwise
+    template<typename T>
+    struct TIsBitwisePayload
+    {
+        enum { Value = TIsBitwiseConstructible<T, T>::Value };
+    };
+
+    template<typename T>
+    struct TIsBitwisePayload<T&>
+    {
+        enum { Value = true };
+    };
+}
+
+/**
+ * A result is a flag next to its payloads, so it can be copied bitwise whenever both payloads can.
+ * Containers then memcpy results instead of running the copy constructor element by element.
+ */
+template<typename T, typename E>
+struct TIsBitwiseConstructible<TResult<T, E>, TResult<T, E>>
+{
+    enum { Value = ResultHelpers::TIsBitwisePayload<T>::Value && ResultHelpers::TIsBitwisePayload<E>::Value };
+};
+
+// Result of an operation that either succeeds without a value or fails
+template<typename E>
+using TVoidResult = TResult<ResultHelpers::FUnit, E>;
+
 // Helper functions for creating Results
 template<typename T>
 auto MakeOk(T&& Value)
@@ -0,0 +1,551 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Async.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/Optional.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/Tuple.h"
+#include "ResultType/Result.h"
+
+#include <atomic>
+#include <tuple>
+#include <utility>
+
+enum class EPipelineOrder : uint8
+{
+    /** Values keep the order of their inputs */
+    Ordered,
+    /** Values are appended as they complete */
+    Unordered,
+};
+
+enum class EPipelineErrorPolicy : uint8
+{
+    /** Failed items are collected and the rest of the inputs keep flowing */
+    Sink,
+    /** The first failure stops the pipeline */
+    Abort,
+};
+
+struct FPipelineOptions
+{
+    EPipelineOrder Order = EPipelineOrder::Ordered;
+    EPipelineErrorPolicy ErrorPolicy = EPipelineErrorPolicy::Sink;
+
+    /** Capacity of each queue between stages, rounded up to a power of two */
+    int32 QueueCapacity = 64;
+};
+
+/** Error raised by a stage, with the index of the input it was processing */
+template<typename E>
+struct TPipelineFailure
+{
+    int32 InputIndex = INDEX_NONE;
+    int32 StageIndex = INDEX_NONE;
+    E Error;
+};
+
+template<typename T, typename E>
+struct TPipelineOutput
+{
+    TArray<T> Values;
+
+    /** Failures routed to the sink, sorted by input index */
+    TArray<TPipelineFailure<E>> Failures;
+};
+
+namespace ResultHelpers
+{
+    /**
+     * Bounded lock-free multi-producer multi-consumer queue, cells carry a sequence number that tells their state
+     * Producers that find it full can sleep on an event until a pop frees a cell, consumers never block.
+     */
+    template<typename T>
+    class TBoundedMpmcQueue
+    {
+    public:
+
+        UE_NONCOPYABLE(TBoundedMpmcQueue);
+
+        explicit TBoundedMpmcQueue(int32 InCapacity)
+            : Mask(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(InCapacity, 2))) - 1)
+            , Cells(new FCell[Mask + 1])
+            , SpaceFreed(FPlatformProcess::GetSynchEventFromPool(false))
+        {
+            for (SIZE_T Index = 0; Index <= Mask; ++Index)
+            {
+                Cells[Index].Sequence.store(Index, std::memory_order_relaxed);
+            }
+        }
+
+        ~TBoundedMpmcQueue()
+        {
+            FPlatformProcess::ReturnSynchEventToPool(SpaceFreed);
+            delete[] Cells;
+        }
+
+        bool TryPush(T&& Value)
+        {
+            FCell* Cell = nullptr;
+            SIZE_T Position = EnqueuePosition.load(std::memory_order_relaxed);
+            while (true)
+            {
+                Cell = &Cells[Position & Mask];
+                const SIZE_T Sequence = Cell->Sequence.load(std::memory_order_acquire);
+                const PTRINT Difference = static_cast<PTRINT>(Sequence) - static_cast<PTRINT>(Position);
+                if (Difference == 0)
+                {
+                    if (EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (Difference < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    Position = EnqueuePosition.load(std::memory_order_relaxed);
+                }
+            }
+
+            Cell->Value = MoveTemp(Value);
+            Cell->Sequence.store(Position + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool TryPop(T& OutValue)
+        {
+            FCell* Cell = nullptr;
+            SIZE_T Position = DequeuePosition.load(std::memory_order_relaxed);
+            while (true)
+            {
+                Cell = &Cells[Position & Mask];
+                const SIZE_T Sequence = Cell->Sequence.load(std::memory_order_acquire);
+                const PTRINT Difference = static_cast<PTRINT>(Sequence) - static_cast<PTRINT>(Position + 1);
+                if (Difference == 0)
+                {
+                    if (DequeuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (Difference < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    Position = DequeuePosition.load(std::memory_order_relaxed);
+                }
+            }
+
+            OutValue = MoveTemp(Cell->Value);
+            Cell->Sequence.store(Position + Mask + 1, std::memory_order_release);
+
+            // Pairs with the fence in WaitForSpace, either the waiter sees this pop or this sees the waiter
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (SpaceWaiters.load(std::memory_order_relaxed) > 0)
+            {
+                SpaceFreed->Trigger();
+            }
+            return true;
+        }
+
+        /** Sleeps until a pop frees a cell, returns straight away if one was freed since the last failed push */
+        void WaitForSpace()
+        {
+            SpaceWaiters.fetch_add(1);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (IsFull())
+            {
+                SpaceFreed->Wait();
+            }
+
+            // Triggers of concurrent pops may have merged into one, pass the wake on while there is room
+            if (SpaceWaiters.fetch_sub(1) > 1 && !IsFull())
+            {
+                SpaceFreed->Trigger();
+            }
+        }
+
+        bool IsEmpty() const
+        {
+            return DequeuePosition.load() == EnqueuePosition.load();
+        }
+
+        bool IsFull() const
+        {
+            // Dequeue first, it never passes the enqueue position read after it
+            const SIZE_T Dequeued = DequeuePosition.load();
+            return EnqueuePosition.load() - Dequeued > Mask;
+        }
+
+        /** Marks the end of input, must be called after the last push */
+        void Close()
+        {
+            bClosed.store(true);
+        }
+
+        bool IsClosed() const
+        {
+            return bClosed.load();
+        }
+
+    private:
+
+        struct FCell
+        {
+            std::atomic<SIZE_T> Sequence{0};
+            T Value;
+        };
+
+        const SIZE_T Mask;
+        FCell* Cells;
+        FEvent* SpaceFreed;
+
+        alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<SIZE_T> EnqueuePosition{0};
+        alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<SIZE_T> DequeuePosition{0};
+        alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<bool> bClosed{false};
+        std::atomic<int32> SpaceWaiters{0};
+    };
+
+    /** Worker counts of one pipeline stage during a run */
+    struct FPipelineStageState
+    {
+        /** Threads currently draining the stage queue, at most the stage parallelism */
+        std::atomic<int32> Running{0};
+
+        /** Tasks launched for the stage that have not started yet */
+        std::atomic<int32> Queued{0};
+
+        std::atomic<bool> bFinished{false};
+
+        bool TryAcquire(int32 Parallelism)
+        {
+            int32 Current = Running.load();
+            while (Current < Parallelism)
+            {
+                if (Running.compare_exchange_weak(Current, Current + 1))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
+    template<typename T>
+    struct TPipelineItem
+    {
+        int32 Index = INDEX_NONE;
+        T Value;
+    };
+
+    template<typename InType, typename FuncType>
+    struct TPipelineStage
+    {
+        using FInput = InType;
+        using FResult = TDecay_T<TInvokeResult_T<const FuncType&, InType&&>>;
+        using FOutput = typename FResult::OkValueType;
+
+        FuncType Func;
+        int32 Parallelism = 1;
+    };
+}
+
+/**
+ * Multi-stage pipeline of fallible functions
+ * Stages are connected by bounded lock-free queues and drained by tasks on the global thread pool, at most
+ * Parallelism at a time per stage. A producer that finds the next queue full while none of its tasks is running
+ * drains it itself, so a run makes progress however busy the pool is. Stage functions are called concurrently
+ * and must be thread-safe when Parallelism is above one.
+ * Build with MakeResultPipeline<InputType, ErrorType>() and chain Stage calls.
+ */
+template<typename E, typename InputType, typename OutputType, typename... StageTypes>
+class TResultPipeline
+{
+public:
+
+    using FOutput = TPipelineOutput<OutputType, E>;
+    using FRunResult = TResult<FOutput, TPipelineFailure<E>>;
+
+    TResultPipeline() = default;
+
+    explicit TResultPipeline(TTuple<StageTypes...>&& InStages)
+        : Stages(MoveTemp(InStages))
+    {
+    }
+
+    /** Appends a stage taking the previous output and returning TResult<NewOutput, E> */
+    template<typename FuncType>
+    auto Stage(FuncType&& Func, int32 Parallelism = 1) const
+    {
+        using FNewStage = ResultHelpers::TPipelineStage<OutputType, TDecay_T<FuncType>>;
+        static_assert(std::is_same_v<typename FNewStage::FResult::ErrValueType, E>, "Stage must return a TResult with the pipeline error type");
+
+        using FNewPipeline = TResultPipeline<E, InputType, typename FNewStage::FOutput, StageTypes..., FNewStage>;
+        return FNewPipeline(AppendStage(FNewStage{Forward<FuncType>(Func), FMath::Max(Parallelism, 1)}, std::index_sequence_for<StageTypes...>()));
+    }
+
+    /** Pushes every input through the stages and blocks until the pipeline has drained */
+    FRunResult Run(TArray<InputType> Inputs, const FPipelineOptions& Options = FPipelineOptions()) const
+    {
+        static_assert(sizeof...(StageTypes) > 0, "A pipeline needs at least one stage");
+        return RunStages(MoveTemp(Inputs), Options, std::index_sequence_for<StageTypes...>());
+    }
+
+private:
+
+    template<typename, typename, typename, typename...>
+    friend class TResultPipeline;
+
+    static constexpr int32 NumStages = sizeof...(StageTypes);
+
+    template<uint32 Index>
+    using TStageAt = std::tuple_element_t<Index, std::tuple<StageTypes...>>;
+
+    using FQueues = TTuple<TUniquePtr<ResultHelpers::TBoundedMpmcQueue<ResultHelpers::TPipelineItem<typename StageTypes::FInput>>>...>;
+
+    struct FRunState
+    {
+        explicit FRunState(const FPipelineOptions& InOptions)
+            : Options(InOptions)
+            , Queues(MakeUnique<ResultHelpers::TBoundedMpmcQueue<ResultHelpers::TPipelineItem<typename StageTypes::FInput>>>(InOptions.QueueCapacity)...)
+            , Drained(FPlatformProcess::GetSynchEventFromPool(true))
+        {
+        }
+
+        ~FRunState()
+        {
+            FPlatformProcess::ReturnSynchEventToPool(Drained);
+        }
+
+        FPipelineOptions Options;
+        FQueues Queues;
+        std::atomic<bool> bAborted{false};
+        ResultHelpers::FPipelineStageState StageStates[sizeof...(StageTypes) > 0 ? sizeof...(StageTypes) : 1];
+
+        /** One reference for the run until its last stage finishes and one per launched task */
+        std::atomic<int32> Outstanding{1};
+        FEvent* Drained;
+
+        FCriticalSection Lock;
+        TArray<TPipelineFailure<E>> Failures;
+        TArray<TOptional<OutputType>> OrderedValues;
+        TArray<OutputType> UnorderedValues;
+
+        /** Drops a reference, the last one wakes the calling thread and nothing may touch the state after it */
+        void Release()
+        {
+            if (Outstanding.fetch_sub(1) == 1)
+            {
+                Drained->Trigger();
+            }
+        }
+
+        void ReportFailure(int32 StageIndex, int32 InputIndex, const E& Error)
+        {
+            FScopeLock ScopeLock(&Lock);
+            if (Options.ErrorPolicy == EPipelineErrorPolicy::Abort)
+            {
+                // Keep only the first failure, later ones are side effects of the abort
+                if (bAborted.exchange(true))
+                {
+                    return;
+                }
+            }
+            Failures.Add(TPipelineFailure<E>{InputIndex, StageIndex, Error});
+        }
+
+        void Emit(int32 InputIndex, OutputType&& Value)
+        {
+            if (Options.Order == EPipelineOrder::Ordered)
+            {
+                // Every input index is written by exactly one worker
+                OrderedValues[InputIndex] = MoveTemp(Value);
+            }
+            else
+            {
+                FScopeLock ScopeLock(&Lock);
+                UnorderedValues.Add(MoveTemp(Value));
+            }
+        }
+    };
+
+    template<typename NewStageType, SIZE_T... Indices>
+    TTuple<StageTypes..., NewStageType> AppendStage(NewStageType&& NewStage, std::index_sequence<Indices...>) const
+    {
+        return TTuple<StageTypes..., NewStageType>(Stages.template Get<Indices>()..., MoveTemp(NewStage));
+    }
+
+    template<SIZE_T... Indices>
+    FRunResult RunStages(TArray<InputType>&& Inputs, const FPipelineOptions& Options, std::index_sequence<Indices...>) const
+    {
+        const int32 NumInputs = Inputs.Num();
+
+        FRunState State(Options);
+        if (Options.Order == EPipelineOrder::Ordered)
+        {
+            State.OrderedValues.SetNum(NumInputs);
+        }
+
+        // The calling thread feeds the first stage and drains it itself whenever it falls behind
+        for (int32 Index = 0; Index < NumInputs && !State.bAborted.load(std::memory_order_relaxed); ++Index)
+        {
+            PushToStage<0>(State, ResultHelpers::TPipelineItem<InputType>{Index, MoveTemp(Inputs[Index])});
+        }
+        State.Queues.template Get<0>()->Close();
+        CheckFinished<0>(State);
+
+        State.Drained->Wait();
+
+        if (State.bAborted.load())
+        {
+            return FRunResult(ResultHelpers::Err, State.Failures[0]);
+        }
+
+        FOutput Output;
+        if (Options.Order == EPipelineOrder::Ordered)
+        {
+            Output.Values.Reserve(NumInputs);
+            for (TOptional<OutputType>& Value : State.OrderedValues)
+            {
+                if (Value.IsSet())
+                {
+                    Output.Values.Add(MoveTemp(Value.GetValue()));
+                }
+            }
+        }
+        else
+        {
+            Output.Values = MoveTemp(State.UnorderedValues);
+        }
+
+        Output.Failures = MoveTemp(State.Failures);
+        Output.Failures.Sort([](const TPipelineFailure<E>& A, const TPipelineFailure<E>& B) { return A.InputIndex < B.InputIndex; });
+        return FRunResult(ResultHelpers::Ok, MoveTemp(Output));
+    }
+
+    /** Queues an item for a stage, blocking only while every worker the stage may have is running */
+    template<uint32 StageIndex>
+    void PushToStage(FRunState& State, ResultHelpers::TPipelineItem<typename TStageAt<StageIndex>::FInput>&& Item) const
+    {
+        auto& Queue = *State.Queues.template Get<StageIndex>();
+        ResultHelpers::FPipelineStageState& StageState = State.StageStates[StageIndex];
+        const int32 Parallelism = Stages.template Get<StageIndex>().Parallelism;
+
+        while (!Queue.TryPush(MoveTemp(Item)))
+        {
+            // Running workers pop without ever waiting on this stage, anything else may be stuck behind us in the pool
+            if (StageState.TryAcquire(Parallelism))
+            {
+                DrainStage<StageIndex>(State);
+            }
+            else
+            {
+                Queue.WaitForSpace();
+            }
+        }
+
+        // Pairs with the fence in DrainStage, a worker that just went idle either sees the item or is seen here
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (StageState.Running.load() + StageState.Queued.load() < Parallelism)
+        {
+            StageState.Queued.fetch_add(1);
+            State.Outstanding.fetch_add(1);
+            Async(EAsyncExecution::ThreadPool, [this, &State]()
+            {
+                State.StageStates[StageIndex].Queued.fetch_sub(1);
+                if (State.StageStates[StageIndex].TryAcquire(Stages.template Get<StageIndex>().Parallelism))
+                {
+                    DrainStage<StageIndex>(State);
+                }
+                CheckFinished<StageIndex>(State);
+                State.Release();
+            });
+        }
+    }
+
+    /** Runs the stage until its queue is empty, the caller must hold one of the stage's running slots */
+    template<uint32 StageIndex>
+    void DrainStage(FRunState& State) const
+    {
+        using FStage = TStageAt<StageIndex>;
+        const FStage& CurrentStage = Stages.template Get<StageIndex>();
+        auto& Queue = *State.Queues.template Get<StageIndex>();
+        ResultHelpers::FPipelineStageState& StageState = State.StageStates[StageIndex];
+
+        do
+        {
+            ResultHelpers::TPipelineItem<typename FStage::FInput> Item;
+            while (Queue.TryPop(Item))
+            {
+                // After an abort the remaining items are drained without running the stage
+                if (State.bAborted.load(std::memory_order_relaxed))
+                {
+                    continue;
+                }
+
+                typename FStage::FResult Result = CurrentStage.Func(MoveTemp(Item.Value));
+                if (Result.IsErr())
+                {
+                    State.ReportFailure(StageIndex, Item.Index, Result.UnwrapErr());
+                    continue;
+                }
+
+                if constexpr (StageIndex + 1 < NumStages)
+                {
+                    PushToStage<StageIndex + 1>(State, ResultHelpers::TPipelineItem<typename FStage::FOutput>{Item.Index, Result.MoveUnwrap()});
+                }
+                else
+                {
+                    State.Emit(Item.Index, OutputType(Result.MoveUnwrap()));
+                }
+            }
+
+            StageState.Running.fetch_sub(1);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+        // An item pushed while the slot was being given up would otherwise wait for the next push
+        while (!Queue.IsEmpty() && StageState.TryAcquire(CurrentStage.Parallelism));
+    }
+
+    /** Closes the next stage once this one has drained its closed queue and has no workers left */
+    template<uint32 StageIndex>
+    void CheckFinished(FRunState& State) const
+    {
+        ResultHelpers::FPipelineStageState& StageState = State.StageStates[StageIndex];
+        auto& Queue = *State.Queues.template Get<StageIndex>();
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!Queue.IsClosed() || !Queue.IsEmpty() || StageState.Running.load() > 0 || StageState.Queued.load() > 0 || StageState.bFinished.exchange(true))
+        {
+            return;
+        }
+
+        if constexpr (StageIndex + 1 < NumStages)
+        {
+            State.Queues.template Get<StageIndex + 1>()->Close();
+            CheckFinished<StageIndex + 1>(State);
+        }
+        else
+        {
+            State.Release();
+        }
+    }
+
+    TTuple<StageTypes...> Stages;
+};
+
+template<typename InputType, typename E>
+TResultPipeline<E, InputType, InputType> MakeResultPipeline()
+{
+    return TResultPipeline<E, InputType, InputType>();
+}
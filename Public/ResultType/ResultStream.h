@@ -0,0 +1,373 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Async.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/Optional.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/Function.h"
+#include "ResultType/Result.h"
+
+template<typename T, typename E>
+class TResultStream;
+
+namespace ResultHelpers
+{
+    /** Bounded single-producer single-consumer queue between a stream and its background producer */
+    template<typename T, typename E>
+    struct TStreamBuffer
+    {
+        explicit TStreamBuffer(int32 InCapacity)
+            : Capacity(FMath::Max(InCapacity, 1))
+            , ItemAvailable(FPlatformProcess::GetSynchEventFromPool(false))
+            , SpaceAvailable(FPlatformProcess::GetSynchEventFromPool(false))
+        {
+            Slots.SetNum(Capacity);
+        }
+
+        ~TStreamBuffer()
+        {
+            FPlatformProcess::ReturnSynchEventToPool(ItemAvailable);
+            FPlatformProcess::ReturnSynchEventToPool(SpaceAvailable);
+        }
+
+        /** Blocks while the buffer is full, returns false once the consumer has gone away */
+        bool Push(TResult<T, E>&& Item)
+        {
+            while (true)
+            {
+                {
+                    FScopeLock ScopeLock(&Lock);
+                    if (bCancelled)
+                    {
+                        return false;
+                    }
+                    if (Count < Capacity)
+                    {
+                        Slots[(Head + Count) % Capacity] = MoveTemp(Item);
+                        ++Count;
+                        ItemAvailable->Trigger();
+                        return true;
+                    }
+                }
+                SpaceAvailable->Wait();
+            }
+        }
+
+        /** Blocks while the buffer is empty, returns an unset optional once the producer is done */
+        TOptional<TResult<T, E>> Pop()
+        {
+            while (true)
+            {
+                {
+                    FScopeLock ScopeLock(&Lock);
+                    if (Count > 0)
+                    {
+                        TOptional<TResult<T, E>> Item = MoveTemp(Slots[Head]);
+                        Slots[Head].Reset();
+                        Head = (Head + 1) % Capacity;
+                        --Count;
+                        SpaceAvailable->Trigger();
+                        return Item;
+                    }
+                    if (bProducerDone)
+                    {
+                        return TOptional<TResult<T, E>>();
+                    }
+                }
+                ItemAvailable->Wait();
+            }
+        }
+
+        void FinishProducing()
+        {
+            FScopeLock ScopeLock(&Lock);
+            bProducerDone = true;
+            ItemAvailable->Trigger();
+        }
+
+        void Cancel()
+        {
+            FScopeLock ScopeLock(&Lock);
+            bCancelled = true;
+            SpaceAvailable->Trigger();
+        }
+
+    private:
+
+        FCriticalSection Lock;
+        TArray<TOptional<TResult<T, E>>> Slots;
+        int32 Capacity = 1;
+        int32 Head = 0;
+        int32 Count = 0;
+        bool bProducerDone = false;
+        bool bCancelled = false;
+        FEvent* ItemAvailable = nullptr;
+        FEvent* SpaceAvailable = nullptr;
+    };
+
+    /** Source of a buffered stream, stops and joins the producer thread when destroyed */
+    template<typename T, typename E>
+    struct TBufferedStreamSource
+    {
+        TBufferedStreamSource(TResultStream<T, E>&& Upstream, int32 Capacity)
+            : Buffer(MakeShared<TStreamBuffer<T, E>, ESPMode::ThreadSafe>(Capacity))
+        {
+            Producer = Async(EAsyncExecution::Thread, [Buffer = Buffer, Upstream = MoveTemp(Upstream)]() mutable
+            {
+                while (TOptional<TResult<T, E>> Item = Upstream.Next())
+                {
+                    if (!Buffer->Push(MoveTemp(Item.GetValue())))
+                    {
+                        return;
+                    }
+                }
+                Buffer->FinishProducing();
+            });
+        }
+
+        TBufferedStreamSource(TBufferedStreamSource&&) = default;
+
+        ~TBufferedStreamSource()
+        {
+            if (Buffer.IsValid())
+            {
+                Buffer->Cancel();
+                Producer.Wait();
+            }
+        }
+
+        TOptional<TResult<T, E>> operator()()
+        {
+            return Buffer->Pop();
+        }
+
+    private:
+
+        TSharedPtr<TStreamBuffer<T, E>, ESPMode::ThreadSafe> Buffer;
+        TFuture<void> Producer;
+    };
+}
+
+/**
+ * Pull-based stream of results
+ * Each call to Next() pulls one item from the source, an unset optional marks the end of the stream.
+ * An error is terminal: it is returned once and the stream is finished afterwards. Adaptors are lazy
+ * and consume the stream they are called on, Buffered moves the upstream work to a producer thread
+ * that blocks when its bounded buffer is full.
+ */
+template<typename T, typename E>
+class TResultStream
+{
+public:
+
+    using FItem = TResult<T, E>;
+    using FSource = TUniqueFunction<TOptional<FItem>()>;
+
+    TResultStream() = default;
+
+    explicit TResultStream(FSource&& InSource)
+        : Source(MoveTemp(InSource))
+        , bFinished(!Source)
+    {
+    }
+
+    TResultStream(TResultStream&&) = default;
+    TResultStream& operator=(TResultStream&&) = default;
+
+    static TResultStream FromArray(TArray<T> Values)
+    {
+        return TResultStream([Values = MoveTemp(Values), Index = 0]() mutable -> TOptional<FItem>
+        {
+            if (Index >= Values.Num())
+            {
+                return TOptional<FItem>();
+            }
+            return FItem(ResultHelpers::Ok, MoveTemp(Values[Index++]));
+        });
+    }
+
+    TOptional<FItem> Next()
+    {
+        if (bFinished)
+        {
+            return TOptional<FItem>();
+        }
+
+        TOptional<FItem> Item = Source();
+        if (!Item.IsSet() || Item->IsErr())
+        {
+            bFinished = true;
+            Source = nullptr;
+            if (Item.IsSet())
+            {
+                TerminalError = Item->UnwrapErr();
+            }
+        }
+        return Item;
+    }
+
+    /** Next() in the fallible iterator protocol of FallibleIterator.h, the end of the stream is an unset Ok value */
+    TResult<TOptional<T>, E> TryNext()
+    {
+        TOptional<FItem> Item = Next();
+        if (!Item.IsSet())
+        {
+            return TResult<TOptional<T>, E>(ResultHelpers::Ok, TOptional<T>());
+        }
+        if (Item->IsErr())
+        {
+            return TResult<TOptional<T>, E>(ResultHelpers::Err, Item->UnwrapErr());
+        }
+        return TResult<TOptional<T>, E>(ResultHelpers::Ok, TOptional<T>(Item->MoveUnwrap()));
+    }
+
+    bool IsFinished() const { return bFinished; }
+
+    /** The error that ended the stream, unset if it ran to completion or is still running */
+    const TOptional<E>& GetTerminalError() const { return TerminalError; }
+
+    // Adaptors
+    template<typename F>
+    auto Map(F&& Func) &&
+    {
+        using U = TDecay_T<TInvokeResult_T<F&, T&&>>;
+        return TResultStream<U, E>([Upstream = MoveTemp(*this), Func = Forward<F>(Func)]() mutable -> TOptional<TResult<U, E>>
+        {
+            TOptional<FItem> Item = Upstream.Next();
+            if (!Item.IsSet())
+            {
+                return TOptional<TResult<U, E>>();
+            }
+            if (Item->IsErr())
+            {
+                return TResult<U, E>(ResultHelpers::Err, Item->UnwrapErr());
+            }
+            return TResult<U, E>(ResultHelpers::Ok, Func(Item->MoveUnwrap()));
+        });
+    }
+
+    /** Fallible transform, an error from Func ends the stream */
+    template<typename F>
+    auto AndThen(F&& Func) &&
+    {
+        using FResultType = TDecay_T<TInvokeResult_T<F&, T&&>>;
+        using U = typename FResultType::OkValueType;
+        return TResultStream<U, E>([Upstream = MoveTemp(*this), Func = Forward<F>(Func)]() mutable -> TOptional<TResult<U, E>>
+        {
+            TOptional<FItem> Item = Upstream.Next();
+            if (!Item.IsSet())
+            {
+                return TOptional<TResult<U, E>>();
+            }
+            if (Item->IsErr())
+            {
+                return TResult<U, E>(ResultHelpers::Err, Item->UnwrapErr());
+            }
+            return Func(Item->MoveUnwrap());
+        });
+    }
+
+    template<typename P>
+    TResultStream Filter(P&& Predicate) &&
+    {
+        return TResultStream([Upstream = MoveTemp(*this), Predicate = Forward<P>(Predicate)]() mutable -> TOptional<FItem>
+        {
+            while (true)
+            {
+                TOptional<FItem> Item = Upstream.Next();
+                if (!Item.IsSet() || Item->IsErr() || Predicate(Item->Unwrap()))
+                {
+                    return Item;
+                }
+            }
+        });
+    }
+
+    /** Groups items into arrays of up to Size, a partial batch is emitted before a terminal error */
+    TResultStream<TArray<T>, E> Batch(int32 Size) &&
+    {
+        using FBatch = TResult<TArray<T>, E>;
+        return TResultStream<TArray<T>, E>([Upstream = MoveTemp(*this), Size = FMath::Max(Size, 1), PendingError = TOptional<E>()]() mutable -> TOptional<FBatch>
+        {
+            if (PendingError.IsSet())
+            {
+                FBatch Error(ResultHelpers::Err, PendingError.GetValue());
+                PendingError.Reset();
+                return Error;
+            }
+
+            TArray<T> Items;
+            Items.Reserve(Size);
+            while (Items.Num() < Size)
+            {
+                TOptional<FItem> Item = Upstream.Next();
+                if (!Item.IsSet())
+                {
+                    break;
+                }
+                if (Item->IsErr())
+                {
+                    if (Items.Num() == 0)
+                    {
+                        return FBatch(ResultHelpers::Err, Item->UnwrapErr());
+                    }
+                    PendingError = Item->UnwrapErr();
+                    break;
+                }
+                Items.Add(Item->MoveUnwrap());
+            }
+
+            if (Items.Num() == 0)
+            {
+                return TOptional<FBatch>();
+            }
+            return FBatch(ResultHelpers::Ok, MoveTemp(Items));
+        });
+    }
+
+    /** Pulls the upstream on a dedicated thread, at most Capacity items are buffered ahead of the consumer */
+    TResultStream Buffered(int32 Capacity) &&
+    {
+        return TResultStream(ResultHelpers::TBufferedStreamSource<T, E>(MoveTemp(*this), Capacity));
+    }
+
+    // Consumers
+    TResult<TArray<T>, E> Collect()
+    {
+        TArray<T> Values;
+        while (TOptional<FItem> Item = Next())
+        {
+            if (Item->IsErr())
+            {
+                return TResult<TArray<T>, E>(ResultHelpers::Err, Item->UnwrapErr());
+            }
+            Values.Add(Item->MoveUnwrap());
+        }
+        return TResult<TArray<T>, E>(ResultHelpers::Ok, MoveTemp(Values));
+    }
+
+    template<typename F>
+    TVoidResult<E> ForEach(F&& Func)
+    {
+        while (TOptional<FItem> Item = Next())
+        {
+            if (Item->IsErr())
+            {
+                return TVoidResult<E>(ResultHelpers::Err, Item->UnwrapErr());
+            }
+            Func(Item->MoveUnwrap());
+        }
+        return TVoidResult<E>(ResultHelpers::Ok, ResultHelpers::Unit);
+    }
+
+private:
+
+    FSource Source;
+    bool bFinished = true;
+    TOptional<E> TerminalError;
+};
@@ -0,0 +1,45 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+#include "ResultType/Result.h"
+
+enum class EEncodingErrorKind : uint8
+{
+    InvalidLeadByte,
+    UnexpectedContinuation,
+    InvalidContinuation,
+    Truncated,
+    Overlong,
+    Surrogate,
+    OutOfRange,
+    UnpairedSurrogate,
+};
+
+/** Encoding failure, Offset is the index of the first code unit of the malformed sequence */
+struct FEncodingError
+{
+    EEncodingErrorKind Kind = EEncodingErrorKind::InvalidLeadByte;
+    int32 Offset = 0;
+
+    FString GetErrorMessage() const;
+    int32 GetErrorCode() const { return static_cast<int32>(Kind); }
+
+    bool operator==(const FEncodingError& Other) const
+    {
+        return Kind == Other.Kind && Offset == Other.Offset;
+    }
+};
+
+/**
+ * Strict UTF-8 and UTF-16 validation and transcoding to TCHAR
+ * ASCII runs and surrogate-free UTF-16 runs are skipped 16 bytes at a time with SSE2 or NEON
+ * when available, with a scalar word-at-a-time fallback. Offsets are in code units of the input.
+ */
+RESULTERRORHANDLINGTYPE_API TVoidResult<FEncodingError> ValidateUtf8(TArrayView<const uint8> Bytes);
+RESULTERRORHANDLINGTYPE_API TVoidResult<FEncodingError> ValidateUtf16(TArrayView<const UTF16CHAR> Units);
+
+RESULTERRORHANDLINGTYPE_API TResult<FString, FEncodingError> Utf8ToTChar(TArrayView<const uint8> Bytes);
+RESULTERRORHANDLINGTYPE_API TResult<FString, FEncodingError> Utf16ToTChar(TArrayView<const UTF16CHAR> Units);